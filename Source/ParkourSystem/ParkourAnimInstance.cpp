@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourAnimInstance.h"
+#include "ParkourSystemCharacter.h"
+
+void UParkourAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Character = Cast<AParkourSystemCharacter>(TryGetPawnOwner());
+}
+
+// Game Thread, Copy State Published by the Character
+void UParkourAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeUpdateAnimation(DeltaSeconds);
+
+	if (Character != nullptr)
+	{
+		ParkourAnimState = Character->GetAnimState();
+	}
+}
+
+// Worker Thread, Derive Values from the Copy
+void UParkourAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	bIsSprinting = ParkourAnimState.Mode == EParkourMode::EPM_Sprint;
+	bIsSliding = ParkourAnimState.Mode == EParkourMode::EPM_Slide;
+	bIsCrouching = ParkourAnimState.Mode == EParkourMode::EPM_Crouch;
+}
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "ParkourAnimState.h"
+#include "ParkourAnimInstance.generated.h"
+
+class AParkourSystemCharacter;
+
+/**
+ * Anim instance base for parkour characters.
+ * Copies the character's FParkourAnimState on the game thread, so the AnimBP reads only its own
+ * variables and its update can run on worker threads with multithreaded animation update.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void NativeInitializeAnimation() override;
+
+	// Game Thread, Copy State Published by the Character
+	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+
+	// Worker Thread, Derive Values from the Copy
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+protected:
+	// Copy of the Character's State, Updated Every Frame
+	UPROPERTY(BlueprintReadOnly, Transient, Category = Parkour)
+	FParkourAnimState ParkourAnimState;
+
+	UPROPERTY(BlueprintReadOnly, Transient, Category = Parkour)
+	bool bIsSprinting = false;
+
+	UPROPERTY(BlueprintReadOnly, Transient, Category = Parkour)
+	bool bIsSliding = false;
+
+	UPROPERTY(BlueprintReadOnly, Transient, Category = Parkour)
+	bool bIsCrouching = false;
+
+private:
+	UPROPERTY(Transient)
+	AParkourSystemCharacter* Character;
+};
@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourMode.h"
+#include "ParkourAnimState.generated.h"
+
+/**
+ * Parkour state animation reads, copied by the character once per frame on the game thread.
+ * Plain values only, so the anim instance can hand it to worker threads.
+ */
+USTRUCT(BlueprintType)
+struct FParkourAnimState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = Parkour)
+	EParkourMode Mode = EParkourMode::EPM_None;
+
+	// Horizontal Speed
+	UPROPERTY(BlueprintReadOnly, Category = Parkour)
+	float Speed = 0.f;
+
+	// 0 Standing, 1 Fully Crouched, Follows the Capsule Height
+	UPROPERTY(BlueprintReadOnly, Category = Parkour)
+	float CrouchAlpha = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = Parkour)
+	bool bIsFalling = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = Weapon)
+	bool bHasRifle = false;
+};
@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourBotController.h"
+#include "ParkourLatencyTracker.h"
+#include "ParkourPathFollowingComponent.h"
+#include "ParkourSystemCharacter.h"
+#include "InputActionValue.h"
+
+namespace ParkourBot
+{
+	// Sprint, Slide, Jump out of the Slide and Turn, Repeated
+	static const TArray<FParkourRouteStep>& GetDefaultSteps()
+	{
+		static const TArray<FParkourRouteStep> DefaultSteps = []()
+		{
+			TArray<FParkourRouteStep> Steps;
+
+			FParkourRouteStep& Sprint = Steps.AddDefaulted_GetRef();
+			Sprint.Duration = 1.5f;
+			Sprint.bSprint = true;
+
+			FParkourRouteStep& Slide = Steps.AddDefaulted_GetRef();
+			Slide.Duration = 0.8f;
+			Slide.bCrouch = true;
+
+			FParkourRouteStep& Jump = Steps.AddDefaulted_GetRef();
+			Jump.Duration = 1.f;
+			Jump.bJump = true;
+
+			FParkourRouteStep& Turn = Steps.AddDefaulted_GetRef();
+			Turn.Duration = 1.f;
+			Turn.YawRate = 180.f;
+
+			return Steps;
+		}();
+
+		return DefaultSteps;
+	}
+}
+
+AParkourBotController::AParkourBotController(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UParkourPathFollowingComponent>(TEXT("PathFollowingComponent")))
+	, Route(nullptr)
+	, StepIndex(0)
+	, StepElapsed(0.f)
+	, bJumpHeld(false)
+	, LastMoveInput(FVector2D::ZeroVector)
+	, LastLookInput(FVector2D::ZeroVector)
+{
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void AParkourBotController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	StepIndex = 0;
+	StepElapsed = 0.f;
+	LastMoveInput = FVector2D::ZeroVector;
+	LastLookInput = FVector2D::ZeroVector;
+
+	if (AParkourSystemCharacter* ParkourCharacter = Cast<AParkourSystemCharacter>(InPawn))
+	{
+		if (!GetSteps().IsEmpty())
+		{
+			StartStep(ParkourCharacter, GetSteps()[0]);
+		}
+	}
+}
+
+void AParkourBotController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	AParkourSystemCharacter* ParkourCharacter = Cast<AParkourSystemCharacter>(GetPawn());
+	const TArray<FParkourRouteStep>& Steps = GetSteps();
+	if (ParkourCharacter == nullptr || Steps.IsEmpty())
+	{
+		return;
+	}
+
+	if (bJumpHeld)
+	{
+		ParkourCharacter->StopJumping();
+		bJumpHeld = false;
+	}
+
+	// Path Following Drives the Character Until the Move Ends
+	if (GetMoveStatus() != EPathFollowingStatus::Idle)
+	{
+		return;
+	}
+
+	// Advance to the Next Step, Looping at the End of Route
+	StepElapsed += DeltaSeconds;
+	while (StepElapsed >= Steps[StepIndex].Duration)
+	{
+		StepElapsed -= FMath::Max(Steps[StepIndex].Duration, KINDA_SMALL_NUMBER);
+		StepIndex = (StepIndex + 1) % Steps.Num();
+
+		StartStep(ParkourCharacter, Steps[StepIndex]);
+	}
+
+	const FParkourRouteStep& Step = Steps[StepIndex];
+
+	const FVector2D LookInput(Step.YawRate * DeltaSeconds, 0.f);
+
+	// Tagged When Input Leaves Zero, Like the Started Event the Bindings Tag On
+	if (!LookInput.IsZero() && LastLookInput.IsZero())
+	{
+		FParkourLatencyTracker::Get().Begin(ParkourCharacter, EParkourLatencyProbe::EPLP_Look, EParkourLatencySource::EPLS_Direct);
+	}
+	if (!Step.Move.IsZero() && LastMoveInput.IsZero())
+	{
+		FParkourLatencyTracker::Get().Begin(ParkourCharacter, EParkourLatencyProbe::EPLP_Move, EParkourLatencySource::EPLS_Direct);
+	}
+	LastLookInput = LookInput;
+	LastMoveInput = Step.Move;
+
+	ParkourCharacter->Look(FInputActionValue(LookInput));
+	ParkourCharacter->Move(FInputActionValue(Step.Move));
+}
+
+// Steps of Route in Use
+const TArray<FParkourRouteStep>& AParkourBotController::GetSteps() const
+{
+	return Route ? Route->Steps : ParkourBot::GetDefaultSteps();
+}
+
+// Press Actions of a Step
+void AParkourBotController::StartStep(AParkourSystemCharacter* ParkourCharacter, const FParkourRouteStep& Step)
+{
+	if (Step.bSprint)
+	{
+		FParkourLatencyTracker::Get().Begin(ParkourCharacter, EParkourLatencyProbe::EPLP_Sprint, EParkourLatencySource::EPLS_Direct);
+		ParkourCharacter->Sprint();
+	}
+
+	if (Step.bCrouch)
+	{
+		FParkourLatencyTracker::Get().Begin(ParkourCharacter, EParkourLatencyProbe::EPLP_Crouch, EParkourLatencySource::EPLS_Direct);
+		ParkourCharacter->CrouchSlideKeyPressed();
+	}
+
+	if (Step.bJump)
+	{
+		FParkourLatencyTracker::Get().Begin(ParkourCharacter, EParkourLatencyProbe::EPLP_Jump, EParkourLatencySource::EPLS_Direct);
+		ParkourCharacter->Jump();
+		bJumpHeld = true;
+	}
+}
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "ParkourRoute.h"
+#include "ParkourBotController.generated.h"
+
+class AParkourSystemCharacter;
+
+/**
+ * AI controller feeding synthetic input into AParkourSystemCharacter along a parkour route,
+ * through the same functions the Enhanced Input bindings call.
+ * Bots have no local player, so their presses skip Enhanced Input entirely; latency probes they tag are
+ * reported apart from player presses and only measure the time from the action call to the movement change.
+ * While a move request is active the route pauses and UParkourPathFollowingComponent walks the path,
+ * crouching and double jumping across parkour nav links.
+ */
+UCLASS()
+class PARKOURSYSTEM_API AParkourBotController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+	AParkourBotController(const FObjectInitializer& ObjectInitializer);
+
+	// Route to Follow, Built-in Route is Used If Not Set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route)
+	UParkourRoute* Route;
+
+	virtual void Tick(float DeltaSeconds) override;
+
+protected:
+	virtual void OnPossess(APawn* InPawn) override;
+
+	// Steps of Route in Use
+	const TArray<FParkourRouteStep>& GetSteps() const;
+
+	// Press Actions of a Step
+	void StartStep(AParkourSystemCharacter* ParkourCharacter, const FParkourRouteStep& Step);
+
+	int32 StepIndex;
+
+	float StepElapsed;
+
+	// Jump Pressed Last Frame, Released This Frame
+	bool bJumpHeld;
+
+	// Input Fed Last Frame, to Tag Probes When It Starts
+	FVector2D LastMoveInput;
+
+	FVector2D LastLookInput;
+};
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourMode.h"
+#include "ParkourTuning.h"
+
+// Camera Pose Relative to Its Standing Placement, Written Once per Frame
+struct FParkourCameraPose
+{
+	// Height of the Camera Relative to the Capsule
+	float ZOffset;
+
+	// Roll in Degrees
+	float Roll;
+
+	// Added to the Camera's Field of View
+	float FOVOffset;
+
+	bool HeightEquals(const FParkourCameraPose& Other) const
+	{
+		return FMath::IsNearlyEqual(ZOffset, Other.ZOffset);
+	}
+
+	bool OffsetEquals(const FParkourCameraPose& Other) const
+	{
+		return FMath::IsNearlyEqual(Roll, Other.Roll) && FMath::IsNearlyEqual(FOVOffset, Other.FOVOffset);
+	}
+};
+
+/**
+ * Cosmetic camera effects (crouch height, landing dip, sprint FOV kick, slide roll) combined into one pose.
+ * Only evaluated for the locally controlled pawn; nothing here affects movement.
+ */
+struct FParkourCameraEffects
+{
+	// Start the Landing Dip
+	void NotifyLanded()
+	{
+		LandingDipElapsed = 0.f;
+	}
+
+	// Advance All Effects and Combine Them
+	FParkourCameraPose Evaluate(EParkourMode Mode, float TargetZOffset, float DeltaSeconds, const UParkourTuning& Tuning)
+	{
+		if (!bInitialized)
+		{
+			ZOffset = TargetZOffset;
+			bInitialized = true;
+		}
+
+		ZOffset = FMath::FInterpTo(ZOffset, TargetZOffset, DeltaSeconds, Tuning.CrouchInterpSpeed);
+
+		const float TargetFOVOffset = Mode == EParkourMode::EPM_Sprint || Mode == EParkourMode::EPM_Slide ? Tuning.SprintFOVKick : 0.f;
+		FOVOffset = FMath::FInterpTo(FOVOffset, TargetFOVOffset, DeltaSeconds, Tuning.CameraEffectInterpSpeed);
+
+		const float TargetRoll = Mode == EParkourMode::EPM_Slide ? Tuning.SlideCameraRoll : 0.f;
+		Roll = FMath::FInterpTo(Roll, TargetRoll, DeltaSeconds, Tuning.CameraEffectInterpSpeed);
+
+		// Dip Down and Back up over the Duration
+		float Dip = 0.f;
+		if (LandingDipElapsed < Tuning.LandingDipDuration)
+		{
+			Dip = Tuning.LandingDipDepth * FMath::Sin(PI * LandingDipElapsed / Tuning.LandingDipDuration);
+			LandingDipElapsed += DeltaSeconds;
+		}
+
+		return { ZOffset - Dip, Roll, FOVOffset };
+	}
+
+private:
+	float ZOffset = 0.f;
+
+	float Roll = 0.f;
+
+	float FOVOffset = 0.f;
+
+	float LandingDipElapsed = TNumericLimits<float>::Max();
+
+	bool bInitialized = false;
+};
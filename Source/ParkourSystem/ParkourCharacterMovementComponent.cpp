@@ -0,0 +1,20 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourCharacterMovementComponent.h"
+
+FParkourMoveResponseStats UParkourCharacterMovementComponent::MoveResponseStats;
+
+void UParkourCharacterMovementComponent::ServerSendMoveResponse(const FClientAdjustment& PendingAdjustment)
+{
+	++MoveResponseStats.NumServerResponses;
+	MoveResponseStats.NumServerCorrections += !PendingAdjustment.bAckGoodMove;
+
+	Super::ServerSendMoveResponse(PendingAdjustment);
+}
+
+void UParkourCharacterMovementComponent::ClientAdjustPosition_Implementation(float TimeStamp, FVector NewLoc, FVector NewVel, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode, TOptional<FRotator> OptionalRotation)
+{
+	++MoveResponseStats.NumClientCorrections;
+
+	Super::ClientAdjustPosition_Implementation(TimeStamp, NewLoc, NewVel, NewBase, NewBaseBoneName, bHasBase, bBaseRelativePosition, ServerMovementMode, OptionalRotation);
+}
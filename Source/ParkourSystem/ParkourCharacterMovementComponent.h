@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "ParkourCharacterMovementComponent.generated.h"
+
+/**
+ * Counters of move responses made by UParkourCharacterMovementComponent, summed over all characters.
+ */
+struct FParkourMoveResponseStats
+{
+	// Responses the Server Sent to Client Moves, Acks and Corrections Alike
+	int64 NumServerResponses = 0;
+
+	// Responses the Server Sent that Corrected the Client
+	int64 NumServerCorrections = 0;
+
+	// Corrections Applied by the Owning Client
+	int64 NumClientCorrections = 0;
+};
+
+/**
+ * Character movement that counts the server's move responses and the corrections among them,
+ * so load tests can report how often parkour moves diverge between client and server.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual void ServerSendMoveResponse(const FClientAdjustment& PendingAdjustment) override;
+
+	virtual void ClientAdjustPosition_Implementation(float TimeStamp, FVector NewLoc, FVector NewVel, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode, TOptional<FRotator> OptionalRotation = TOptional<FRotator>()) override;
+
+	static const FParkourMoveResponseStats& GetMoveResponseStats() { return MoveResponseStats; }
+
+	static void ResetMoveResponseStats() { MoveResponseStats = FParkourMoveResponseStats(); }
+
+private:
+	static FParkourMoveResponseStats MoveResponseStats;
+};
@@ -0,0 +1,380 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "ParkourLatencyTracker.h"
+#include "ParkourReplay.h"
+#include "ParkourSlideKernel.h"
+#include "ParkourSystemCharacter.h"
+#include "ParkourSystemGameMode.h"
+#include "ParkourTestFixture.h"
+#include "ParkourTuning.h"
+#include "ParkourWeaponAudioSubsystem.h"
+#include "AIController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+
+#if !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogParkourCommands, Log, All);
+
+namespace ParkourConsoleCommands
+{
+	// Parkour.BenchSlideKernel [NumSlides]
+	static void BenchSlideKernel(const TArray<FString>& Args)
+	{
+		const int32 NumSlides = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10000;
+		const UParkourTuning& Tuning = *GetDefault<UParkourTuning>();
+
+		TArray<FVector> Velocities;
+		TArray<FVector> FloorNormals;
+		Velocities.SetNumUninitialized(NumSlides);
+		FloorNormals.SetNumUninitialized(NumSlides);
+
+		FRandomStream Stream(NumSlides);
+		for (int32 Index = 0; Index < NumSlides; ++Index)
+		{
+			Velocities[Index] = Stream.GetUnitVector() * Stream.FRandRange(0.f, 2.f * Tuning.SlideSpeed);
+			FloorNormals[Index] = FVector(Stream.FRandRange(-0.5f, 0.5f), Stream.FRandRange(-0.5f, 0.5f), 1.f).GetSafeNormal();
+		}
+
+		// Accumulated So that the Compiler Cannot Drop the Work
+		FVector Checksum = FVector::ZeroVector;
+		int32 NumEnded = 0;
+
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumSlides; ++Index)
+		{
+			FVector Force;
+			bool bShouldEnd = false;
+			Checksum += ParkourTestFixture::LegacySlideStep(Velocities[Index], FloorNormals[Index], Tuning, Force, bShouldEnd) + Force;
+			NumEnded += bShouldEnd;
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		const double KernelStart = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumSlides; ++Index)
+		{
+			const FParkourSlideKernel::FResult Result = FParkourSlideKernel::Step(Velocities[Index], FloorNormals[Index], Tuning);
+			Checksum += Result.Velocity + Result.Force;
+			NumEnded += Result.bShouldEnd;
+		}
+		const double KernelSeconds = FPlatformTime::Seconds() - KernelStart;
+
+		UE_LOG(LogParkourCommands, Display, TEXT("Slide kernel, %d slides: legacy %.2f ns/call, kernel %.2f ns/call (checksum %s, %d ended)"),
+			NumSlides,
+			LegacySeconds * 1e9 / NumSlides,
+			KernelSeconds * 1e9 / NumSlides,
+			*Checksum.ToString(),
+			NumEnded);
+	}
+
+	static FAutoConsoleCommand BenchSlideKernelCommand(
+		TEXT("Parkour.BenchSlideKernel"),
+		TEXT("Time the slide step before and after FParkourSlideKernel. Usage: Parkour.BenchSlideKernel [NumSlides=10000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchSlideKernel));
+
+	// Parkour.BenchSpawn [NumCharacters] [NumRounds]
+	static void BenchSpawn(const TArray<FString>& Args, UWorld* World)
+	{
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		const int32 NumCharacters = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+		const int32 NumRounds = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 4;
+
+		TArray<AParkourSystemCharacter*> Characters;
+		Characters.Reserve(NumCharacters);
+
+		// Spawn Without Controllers, as Server and AI Instances are
+		auto SpawnAll = [&]()
+		{
+			for (int32 Index = 0; Index < NumCharacters; ++Index)
+			{
+				const FVector Location = ParkourTestFixture::FarLocation + FVector(static_cast<float>(Index % 32) * 200.f, static_cast<float>(Index / 32) * 200.f, 0.f);
+				if (AParkourSystemCharacter* Character = ParkourTestFixture::SpawnCharacter(World, Location))
+				{
+					Characters.Add(Character);
+				}
+			}
+		};
+
+		auto DestroyAll = [&]()
+		{
+			for (AParkourSystemCharacter* Character : Characters)
+			{
+				Character->Destroy();
+			}
+			Characters.Reset();
+		};
+
+		// Eager is the Previous Behaviour, Mesh1P Registered for Every Character
+		auto TimePass = [&](bool bEager)
+		{
+			const double Start = FPlatformTime::Seconds();
+			SpawnAll();
+			if (bEager)
+			{
+				for (AParkourSystemCharacter* Character : Characters)
+				{
+					Character->GetMesh1P()->RegisterComponent();
+				}
+			}
+			const double Seconds = FPlatformTime::Seconds() - Start;
+			DestroyAll();
+			return Seconds;
+		};
+
+		// Untimed Pass Loads Assets and Warms Caches, so Neither Variant Pays for It
+		TimePass(true);
+
+		// Alternate Which Goes First, so Drift During the Run Affects Both Alike
+		double LazySeconds = 0.0;
+		double EagerSeconds = 0.0;
+		for (int32 Round = 0; Round < NumRounds; ++Round)
+		{
+			const bool bEagerFirst = Round % 2 == 1;
+			const double FirstSeconds = TimePass(bEagerFirst);
+			const double SecondSeconds = TimePass(!bEagerFirst);
+
+			LazySeconds += bEagerFirst ? SecondSeconds : FirstSeconds;
+			EagerSeconds += bEagerFirst ? FirstSeconds : SecondSeconds;
+		}
+		LazySeconds /= NumRounds;
+		EagerSeconds /= NumRounds;
+
+		UE_LOG(LogParkourCommands, Display, TEXT("Spawning %d characters, average of %d rounds: lazy Mesh1P %.2f ms (%.1f us each), eager Mesh1P %.2f ms (%.1f us each)"),
+			NumCharacters,
+			NumRounds,
+			LazySeconds * 1000.0,
+			LazySeconds * 1e6 / NumCharacters,
+			EagerSeconds * 1000.0,
+			EagerSeconds * 1e6 / NumCharacters);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs BenchSpawnCommand(
+		TEXT("Parkour.BenchSpawn"),
+		TEXT("Time spawning characters that are not locally controlled, with and without Mesh1P registered. Usage: Parkour.BenchSpawn [NumCharacters=500] [NumRounds=4]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchSpawn));
+
+	// Parkour.ReplayInfo <Filename>
+	static void ReplayInfo(const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogParkourCommands, Display, TEXT("Usage: Parkour.ReplayInfo <Filename>"));
+			return;
+		}
+
+		FParkourReplayReader Reader;
+		if (!Reader.Open(Args[0]))
+		{
+			UE_LOG(LogParkourCommands, Error, TEXT("%s is not a parkour replay"), *Args[0]);
+			return;
+		}
+
+		// Decode Every Sample, Timing Random Access
+		FParkourReplaySample First = {};
+		FParkourReplaySample Last = {};
+		Reader.GetSample(0, First);
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Reader.GetNumSamples(); ++Index)
+		{
+			Reader.GetSample(Index, Last);
+		}
+		const double DecodeSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+		const float Duration = Reader.GetDuration();
+		UE_LOG(LogParkourCommands, Display, TEXT("%s: %d samples at %.0f Hz, %.1f s, %lld B (%.0f B/s), %.1f ns/sample decoded"),
+			*Args[0],
+			Reader.GetNumSamples(),
+			Reader.GetSampleRate(),
+			Duration,
+			Reader.GetFileSize(),
+			Duration > 0.f ? Reader.GetFileSize() / Duration : 0.f,
+			Reader.GetNumSamples() > 0 ? DecodeSeconds * 1e9 / Reader.GetNumSamples() : 0.0);
+
+		UE_LOG(LogParkourCommands, Display, TEXT("From %s (mode %d) to %s (mode %d)"),
+			*First.Location.ToString(), static_cast<int32>(First.Mode),
+			*Last.Location.ToString(), static_cast<int32>(Last.Mode));
+	}
+
+	static FAutoConsoleCommand ReplayInfoCommand(
+		TEXT("Parkour.ReplayInfo"),
+		TEXT("Print size and decode speed of a replay recorded with parkour.RecordReplays. Usage: Parkour.ReplayInfo <Filename>"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&ReplayInfo));
+
+	// Parkour.LatencyReport [reset]
+	static void LatencyReport(const TArray<FString>& Args)
+	{
+		FParkourLatencyTracker::Get().Report();
+
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			FParkourLatencyTracker::Get().Reset();
+		}
+	}
+
+	static FAutoConsoleCommand LatencyReportCommand(
+		TEXT("Parkour.LatencyReport"),
+		TEXT("Print input-to-motion latency histograms collected while parkour.LatencyTrace is set. Usage: Parkour.LatencyReport [reset]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&LatencyReport));
+
+	// Parkour.MemReport
+	static void MemReport(UWorld* World)
+	{
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		constexpr int32 ParkourBytes = sizeof(FParkourState) + sizeof(FParkourMomentum) + sizeof(FParkourCooldowns);
+
+		int32 NumCharacters = 0;
+		int64 TotalCharacterBytes = 0;
+		for (TActorIterator<AParkourSystemCharacter> It(World); It; ++It)
+		{
+			++NumCharacters;
+			TotalCharacterBytes += It->GetClass()->GetStructureSize();
+		}
+
+		UE_LOG(LogParkourCommands, Display, TEXT("Parkour memory per character: state %d B, momentum %d B, cooldowns %d B, total %d B (cache line %d B)"),
+			static_cast<int32>(sizeof(FParkourState)),
+			static_cast<int32>(sizeof(FParkourMomentum)),
+			static_cast<int32>(sizeof(FParkourCooldowns)),
+			ParkourBytes,
+			PLATFORM_CACHE_LINE_SIZE);
+
+		UE_LOG(LogParkourCommands, Display, TEXT("%d characters: parkour %lld B, character objects %lld B (%d B for AParkourSystemCharacter itself)"),
+			NumCharacters,
+			static_cast<int64>(NumCharacters) * ParkourBytes,
+			TotalCharacterBytes,
+			static_cast<int32>(sizeof(AParkourSystemCharacter)));
+	}
+
+	static FAutoConsoleCommandWithWorld MemReportCommand(
+		TEXT("Parkour.MemReport"),
+		TEXT("Print parkour memory per character and in total for all characters in the world."),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&MemReport));
+
+	// Parkour.WeaponAudioStats
+	static void WeaponAudioStats(UWorld* World)
+	{
+		const UParkourWeaponAudioSubsystem* AudioSubsystem = World != nullptr ? World->GetSubsystem<UParkourWeaponAudioSubsystem>() : nullptr;
+		if (AudioSubsystem == nullptr)
+		{
+			UE_LOG(LogParkourCommands, Warning, TEXT("No weapon audio subsystem in this world"));
+			return;
+		}
+
+		UE_LOG(LogParkourCommands, Display, TEXT("Weapon voices refused: %d over budget, %d out of hearing range"),
+			AudioSubsystem->GetBudgetCulledCount(),
+			AudioSubsystem->GetDistanceCulledCount());
+	}
+
+	static FAutoConsoleCommandWithWorld WeaponAudioStatsCommand(
+		TEXT("Parkour.WeaponAudioStats"),
+		TEXT("Print how many weapon voices parkour.WeaponVoiceBudget and parkour.WeaponVoiceCullDistance refused."),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&WeaponAudioStats));
+
+	// Parkour.BenchRespawn [NumPlayers]
+	static void BenchRespawn(const TArray<FString>& Args, UWorld* World)
+	{
+		AParkourSystemGameMode* GameMode = World != nullptr ? World->GetAuthGameMode<AParkourSystemGameMode>() : nullptr;
+		IConsoleVariable* PoolCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("parkour.RespawnPool"));
+		if (GameMode == nullptr || PoolCVar == nullptr)
+		{
+			UE_LOG(LogParkourCommands, Warning, TEXT("Parkour.BenchRespawn needs AParkourSystemGameMode on the server"));
+			return;
+		}
+
+		const int32 NumPlayers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 64;
+		const bool bPrevPool = PoolCVar->GetBool();
+
+		// Every Player Must be Able to Come from the Pool, on Top of What the Game Mode Pre-warmed
+		const int32 PrevMaxPooled = GameMode->MaxPooledCharacters;
+		GameMode->MaxPooledCharacters = FMath::Max(PrevMaxPooled, GameMode->GetNumPooledCharacters() + NumPlayers);
+
+		TArray<AAIController*> Controllers;
+		for (int32 Index = 0; Index < NumPlayers; ++Index)
+		{
+			if (AAIController* Controller = World->SpawnActor<AAIController>())
+			{
+				Controllers.Add(Controller);
+			}
+		}
+
+		for (const bool bPool : { false, true })
+		{
+			PoolCVar->Set(bPool, ECVF_SetByConsole);
+
+			// Pre-warming Happens Before a Match, not During the Storm
+			double PrewarmMs = 0.0;
+			if (bPool)
+			{
+				const double PrewarmStart = FPlatformTime::Seconds();
+				GameMode->PrewarmCharacterPool(GameMode->GetNumPooledCharacters() + Controllers.Num());
+				PrewarmMs = (FPlatformTime::Seconds() - PrewarmStart) * 1000.0;
+			}
+
+			// Everyone Respawns in the Same Frame
+			double WorstMs = 0.0;
+			int32 NumSpawned = 0;
+			const int32 NumPooledBefore = GameMode->GetNumPooledCharacters();
+			const double StormStart = FPlatformTime::Seconds();
+			for (AAIController* Controller : Controllers)
+			{
+				const double RespawnStart = FPlatformTime::Seconds();
+				GameMode->RestartPlayer(Controller);
+				WorstMs = FMath::Max(WorstMs, (FPlatformTime::Seconds() - RespawnStart) * 1000.0);
+				NumSpawned += Controller->GetPawn() != nullptr;
+			}
+			const double StormMs = (FPlatformTime::Seconds() - StormStart) * 1000.0;
+			const int32 NumFromPool = NumPooledBefore - GameMode->GetNumPooledCharacters();
+
+			UE_LOG(LogParkourCommands, Display, TEXT("Respawn storm, %s: %d/%d respawned in %.2f ms, %.3f ms average, %.3f ms worst%s"),
+				bPool ? TEXT("pooled") : TEXT("spawned"),
+				NumSpawned,
+				Controllers.Num(),
+				StormMs,
+				StormMs / FMath::Max(Controllers.Num(), 1),
+				WorstMs,
+				bPool ? *FString::Printf(TEXT(" (%d from the pool, pre-warm %.2f ms beforehand)"), NumFromPool, PrewarmMs) : TEXT(""));
+
+			if (bPool && NumFromPool < NumSpawned)
+			{
+				UE_LOG(LogParkourCommands, Warning, TEXT("Only %d of %d pooled respawns came from the pool, the rest were spawned"), NumFromPool, NumSpawned);
+			}
+
+			// Everyone Dies, Pooled Characters Go Back for the Next Run
+			for (AAIController* Controller : Controllers)
+			{
+				if (AParkourSystemCharacter* Character = Cast<AParkourSystemCharacter>(Controller->GetPawn()))
+				{
+					Controller->UnPossess();
+					GameMode->ReleaseCharacter(Character);
+				}
+			}
+		}
+
+		for (AAIController* Controller : Controllers)
+		{
+			Controller->Destroy();
+		}
+
+		PoolCVar->Set(bPrevPool, ECVF_SetByConsole);
+		GameMode->MaxPooledCharacters = PrevMaxPooled;
+		GameMode->TrimCharacterPool();
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs BenchRespawnCommand(
+		TEXT("Parkour.BenchRespawn"),
+		TEXT("Respawn many players in one frame, first by spawning new characters, then from the game mode's pre-warmed pool. Usage: Parkour.BenchRespawn [NumPlayers]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchRespawn));
+}
+
+#endif
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EParkourCooldown : uint8
+{
+	EPC_Sprint,
+	EPC_Slide,
+
+	EPC_MAX
+};
+
+/**
+ * Per-character cooldowns stored as world-time timestamps.
+ * Nothing is scheduled; readiness is checked lazily against the current world time.
+ */
+struct FParkourCooldowns
+{
+	// Start Cooldown, Ready Again After Duration Seconds
+	void Start(EParkourCooldown Cooldown, double Now, float Duration)
+	{
+		ReadyTimes[static_cast<int32>(Cooldown)] = Now + Duration;
+	}
+
+	// Make All Cooldowns Ready Immediately
+	void ClearAll()
+	{
+		for (double& ReadyTime : ReadyTimes)
+		{
+			ReadyTime = 0.0;
+		}
+	}
+
+	// Check If Cooldown is Over
+	bool IsReady(EParkourCooldown Cooldown, double Now) const
+	{
+		return Now >= ReadyTimes[static_cast<int32>(Cooldown)];
+	}
+
+private:
+	double ReadyTimes[static_cast<int32>(EParkourCooldown::EPC_MAX)] = {};
+};
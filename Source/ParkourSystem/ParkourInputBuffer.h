@@ -0,0 +1,86 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EParkourInputAction : uint8
+{
+	EPIA_Jump,
+	EPIA_Sprint,
+	EPIA_Crouch
+};
+
+/**
+ * Recent action presses in a small fixed ring, stamped with world time, plus the coyote window after walking off a ledge.
+ * Presses that could not act when they arrived are resolved later against movement mode changes.
+ */
+struct FParkourInputBuffer
+{
+	static constexpr int32 Capacity = 8;
+
+	// Remember a Press, Overwriting the Oldest When Full
+	void Push(EParkourInputAction Action, double Now)
+	{
+		Events[Head] = { Now, Action, false };
+		Head = (Head + 1) % Capacity;
+		Num = FMath::Min(Num + 1, Capacity);
+	}
+
+	// Take the Latest Unconsumed Press of Action Within Window Seconds
+	bool Consume(EParkourInputAction Action, double Now, float Window)
+	{
+		for (int32 Offset = 1; Offset <= Num; ++Offset)
+		{
+			FEvent& Event = Events[(Head - Offset + Capacity) % Capacity];
+			if (Now - Event.Time > Window)
+			{
+				// Older Events are Outside the Window too
+				break;
+			}
+
+			if (Event.Action == Action && !Event.bConsumed)
+			{
+				Event.bConsumed = true;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Character Fell Without Jumping
+	void NotifyWalkedOff(double Now)
+	{
+		WalkedOffTime = Now;
+	}
+
+	void NotifyLanded()
+	{
+		WalkedOffTime = -UE_DOUBLE_BIG_NUMBER;
+	}
+
+	// Take the Ground Jump Still Allowed Shortly After Walking Off
+	bool ConsumeCoyoteJump(double Now, float CoyoteTime)
+	{
+		const bool bAllowed = Now - WalkedOffTime <= CoyoteTime;
+		WalkedOffTime = -UE_DOUBLE_BIG_NUMBER;
+		return bAllowed;
+	}
+
+private:
+	struct FEvent
+	{
+		double Time;
+		EParkourInputAction Action;
+		bool bConsumed;
+	};
+
+	FEvent Events[Capacity] = {};
+
+	double WalkedOffTime = -UE_DOUBLE_BIG_NUMBER;
+
+	int32 Head = 0;
+
+	int32 Num = 0;
+};
@@ -0,0 +1,207 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourLatencyTracker.h"
+#include "ParkourSystemCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogParkourLatency, Log, All);
+
+static TAutoConsoleVariable<bool> CVarParkourLatencyTrace(
+	TEXT("parkour.LatencyTrace"),
+	false,
+	TEXT("Measure frames and milliseconds from parkour action presses to the movement change. Report with Parkour.LatencyReport."));
+
+namespace ParkourLatency
+{
+	// Frames Waited Before a Press is Counted as Dropped
+	static constexpr uint64 TimeoutFrames = 120;
+
+	// Frame Histogram Buckets, the Last One Collects Everything Above
+	static constexpr int32 NumFrameBuckets = 8;
+
+	static const TCHAR* GetProbeName(EParkourLatencyProbe Probe)
+	{
+		switch (Probe)
+		{
+		case EParkourLatencyProbe::EPLP_Jump:
+			return TEXT("Jump -> Velocity.Z");
+		case EParkourLatencyProbe::EPLP_Sprint:
+			return TEXT("Sprint -> MaxWalkSpeed");
+		case EParkourLatencyProbe::EPLP_Crouch:
+			return TEXT("Crouch -> Capsule");
+		case EParkourLatencyProbe::EPLP_Move:
+			return TEXT("Move -> Acceleration");
+		case EParkourLatencyProbe::EPLP_Look:
+			return TEXT("Look -> Control Yaw");
+		default:
+			return TEXT("Unknown");
+		}
+	}
+
+	static const TCHAR* GetSourceName(EParkourLatencySource Source)
+	{
+		return Source == EParkourLatencySource::EPLS_Direct ? TEXT("bots, excluding input processing") : TEXT("Enhanced Input");
+	}
+
+	// Percentile of Sorted Values, Nearest-Rank
+	static float Percentile(const TArray<float>& SortedValues, float Fraction)
+	{
+		if (SortedValues.IsEmpty())
+		{
+			return 0.f;
+		}
+
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+		return SortedValues[Rank];
+	}
+}
+
+FParkourLatencyTracker& FParkourLatencyTracker::Get()
+{
+	static FParkourLatencyTracker Tracker;
+	return Tracker;
+}
+
+bool FParkourLatencyTracker::IsEnabled()
+{
+	return CVarParkourLatencyTrace.GetValueOnGameThread();
+}
+
+// Tag a Press, Before the Action Runs
+void FParkourLatencyTracker::Begin(const AParkourSystemCharacter* Character, EParkourLatencyProbe Probe, EParkourLatencySource Source)
+{
+	if (!IsEnabled() || Character == nullptr)
+	{
+		return;
+	}
+
+	if (!PostActorTickHandle.IsValid())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FParkourLatencyTracker::OnWorldPostActorTick);
+	}
+
+	FPendingProbe& PendingProbe = Pending.AddDefaulted_GetRef();
+	PendingProbe.Character = Character;
+	PendingProbe.StartCycles = FPlatformTime::Cycles64();
+	PendingProbe.StartFrame = GFrameCounter;
+	PendingProbe.Baseline = ReadValue(*Character, Probe);
+	PendingProbe.Probe = Probe;
+	PendingProbe.Source = Source;
+}
+
+// Movement Value a Probe Watches
+float FParkourLatencyTracker::ReadValue(const AParkourSystemCharacter& Character, EParkourLatencyProbe Probe)
+{
+	switch (Probe)
+	{
+	case EParkourLatencyProbe::EPLP_Jump:
+		return Character.GetCharacterMovement()->Velocity.Z;
+	case EParkourLatencyProbe::EPLP_Sprint:
+		return Character.GetCharacterMovement()->MaxWalkSpeed;
+	case EParkourLatencyProbe::EPLP_Crouch:
+		return Character.GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	case EParkourLatencyProbe::EPLP_Move:
+		return Character.GetCharacterMovement()->GetCurrentAcceleration().Size();
+	case EParkourLatencyProbe::EPLP_Look:
+		return Character.GetControlRotation().Yaw;
+	default:
+		return 0.f;
+	}
+}
+
+// Resolve Probes Whose Value the Frame Changed
+void FParkourLatencyTracker::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+
+	for (int32 Index = Pending.Num() - 1; Index >= 0; --Index)
+	{
+		const FPendingProbe& PendingProbe = Pending[Index];
+		const AParkourSystemCharacter* Character = PendingProbe.Character.Get();
+		if (Character == nullptr)
+		{
+			Pending.RemoveAtSwap(Index);
+			continue;
+		}
+
+		// Several Worlds can Tick per Frame, Each Resolves Its Own Characters
+		if (Character->GetWorld() != World)
+		{
+			continue;
+		}
+
+		FProbeResults& ProbeResults = Results[static_cast<int32>(PendingProbe.Source)][static_cast<int32>(PendingProbe.Probe)];
+		const float Value = ReadValue(*Character, PendingProbe.Probe);
+
+		// Jump Must Push Upward, the Others Just Change
+		const bool bChanged = PendingProbe.Probe == EParkourLatencyProbe::EPLP_Jump ? Value > PendingProbe.Baseline + 1.f : !FMath::IsNearlyEqual(Value, PendingProbe.Baseline);
+
+		if (bChanged)
+		{
+			ProbeResults.LatencyMs.Add(static_cast<float>(FPlatformTime::ToMilliseconds64(NowCycles - PendingProbe.StartCycles)));
+			ProbeResults.LatencyFrames.Add(static_cast<int32>(GFrameCounter - PendingProbe.StartFrame));
+			Pending.RemoveAtSwap(Index);
+		}
+		else if (GFrameCounter - PendingProbe.StartFrame > ParkourLatency::TimeoutFrames)
+		{
+			++ProbeResults.NumDropped;
+			Pending.RemoveAtSwap(Index);
+		}
+	}
+}
+
+// Log Histograms of Everything Resolved So Far
+void FParkourLatencyTracker::Report() const
+{
+	for (int32 SourceIndex = 0; SourceIndex < static_cast<int32>(EParkourLatencySource::EPLS_MAX); ++SourceIndex)
+	{
+		for (int32 ProbeIndex = 0; ProbeIndex < static_cast<int32>(EParkourLatencyProbe::EPLP_MAX); ++ProbeIndex)
+		{
+			const FProbeResults& ProbeResults = Results[SourceIndex][ProbeIndex];
+			if (ProbeResults.LatencyMs.IsEmpty() && ProbeResults.NumDropped == 0)
+			{
+				continue;
+			}
+
+			TArray<float> SortedMs = ProbeResults.LatencyMs;
+			SortedMs.Sort();
+
+			int32 FrameBuckets[ParkourLatency::NumFrameBuckets] = {};
+			for (const int32 Frames : ProbeResults.LatencyFrames)
+			{
+				++FrameBuckets[FMath::Min(Frames, ParkourLatency::NumFrameBuckets - 1)];
+			}
+
+			FString Histogram;
+			for (int32 Bucket = 0; Bucket < ParkourLatency::NumFrameBuckets; ++Bucket)
+			{
+				Histogram += FString::Printf(TEXT(" %d%s:%d"), Bucket, Bucket == ParkourLatency::NumFrameBuckets - 1 ? TEXT("+") : TEXT(""), FrameBuckets[Bucket]);
+			}
+
+			UE_LOG(LogParkourLatency, Display, TEXT("%s (%s): %d presses, %d dropped, ms p50 %.2f p90 %.2f p99 %.2f, frames%s"),
+				ParkourLatency::GetProbeName(static_cast<EParkourLatencyProbe>(ProbeIndex)),
+				ParkourLatency::GetSourceName(static_cast<EParkourLatencySource>(SourceIndex)),
+				SortedMs.Num(),
+				ProbeResults.NumDropped,
+				ParkourLatency::Percentile(SortedMs, 0.5f),
+				ParkourLatency::Percentile(SortedMs, 0.9f),
+				ParkourLatency::Percentile(SortedMs, 0.99f),
+				*Histogram);
+		}
+	}
+}
+
+void FParkourLatencyTracker::Reset()
+{
+	Pending.Reset();
+	for (int32 SourceIndex = 0; SourceIndex < static_cast<int32>(EParkourLatencySource::EPLS_MAX); ++SourceIndex)
+	{
+		for (FProbeResults& ProbeResults : Results[SourceIndex])
+		{
+			ProbeResults = FProbeResults();
+		}
+	}
+}
@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+
+class AParkourSystemCharacter;
+class UWorld;
+
+enum class EParkourLatencyProbe : uint8
+{
+	// Jump Pressed -> Upward Velocity
+	EPLP_Jump,
+
+	// Sprint Pressed -> MaxWalkSpeed Changed
+	EPLP_Sprint,
+
+	// Crouch Pressed -> Capsule Height Changed
+	EPLP_Crouch,
+
+	// Move Started -> Acceleration Changed
+	EPLP_Move,
+
+	// Look Started -> Control Yaw Changed
+	EPLP_Look,
+
+	EPLP_MAX
+};
+
+enum class EParkourLatencySource : uint8
+{
+	// Tagged by an Enhanced Input Binding, Includes Input Processing
+	EPLS_Input,
+
+	// Tagged by a Bot Calling the Action Directly, Excludes Input Processing
+	EPLS_Direct,
+
+	EPLS_MAX
+};
+
+/**
+ * Measures input-to-motion latency while parkour.LatencyTrace is set.
+ * A press is tagged with a timestamp and the movement value it should change; after every world tick,
+ * pending tags whose value changed are resolved into frame and millisecond latencies.
+ * Presses from Enhanced Input and from bots calling actions directly are reported apart,
+ * since the latter skip input processing and only measure the movement side.
+ */
+class PARKOURSYSTEM_API FParkourLatencyTracker
+{
+public:
+	static FParkourLatencyTracker& Get();
+
+	static bool IsEnabled();
+
+	// Tag a Press, Before the Action Runs
+	void Begin(const AParkourSystemCharacter* Character, EParkourLatencyProbe Probe, EParkourLatencySource Source = EParkourLatencySource::EPLS_Input);
+
+	// Log Histograms of Everything Resolved So Far
+	void Report() const;
+
+	void Reset();
+
+private:
+	struct FPendingProbe
+	{
+		TWeakObjectPtr<const AParkourSystemCharacter> Character;
+		uint64 StartCycles;
+		uint64 StartFrame;
+		float Baseline;
+		EParkourLatencyProbe Probe;
+		EParkourLatencySource Source;
+	};
+
+	struct FProbeResults
+	{
+		TArray<float> LatencyMs;
+		TArray<int32> LatencyFrames;
+
+		// Presses that Changed Nothing Within the Timeout
+		int32 NumDropped = 0;
+	};
+
+	// Movement Value a Probe Watches
+	static float ReadValue(const AParkourSystemCharacter& Character, EParkourLatencyProbe Probe);
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	TArray<FPendingProbe> Pending;
+
+	FProbeResults Results[static_cast<int32>(EParkourLatencySource::EPLS_MAX)][static_cast<int32>(EParkourLatencyProbe::EPLP_MAX)];
+
+	FDelegateHandle PostActorTickHandle;
+};
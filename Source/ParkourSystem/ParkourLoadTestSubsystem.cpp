@@ -0,0 +1,285 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourLoadTestSubsystem.h"
+#include "ParkourBotController.h"
+#include "ParkourCharacterMovementComponent.h"
+#include "ParkourLatencyTracker.h"
+#include "ParkourReplicationGraph.h"
+#include "ParkourRoute.h"
+#include "EngineUtils.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogParkourLoadTest);
+
+namespace ParkourLoadTest
+{
+	// Percentile of Sorted Values, Nearest-Rank
+	static float Percentile(const TArray<float>& SortedValues, float Fraction)
+	{
+		if (SortedValues.IsEmpty())
+		{
+			return 0.f;
+		}
+
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+		return SortedValues[Rank];
+	}
+}
+
+UParkourLoadTestSubsystem::UParkourLoadTestSubsystem()
+	: Route(nullptr)
+	, NumBots(8)
+	, WarmupSeconds(5.f)
+	, DurationSeconds(60.f)
+	, ElapsedSeconds(0.f)
+	, NextBandwidthSampleSeconds(0.f)
+	, bExitOnReport(false)
+	, bRunning(false)
+	, OutBytesPerClientSum(0.0)
+	, NumBandwidthSamples(0)
+	, MaxClientConnections(0)
+{
+}
+
+bool UParkourLoadTestSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && FParse::Param(FCommandLine::Get(), TEXT("ParkourLoadTest"));
+}
+
+bool UParkourLoadTestSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UParkourLoadTestSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("ParkourBots="), NumBots);
+	FParse::Value(CommandLine, TEXT("ParkourWarmup="), WarmupSeconds);
+	FParse::Value(CommandLine, TEXT("ParkourDuration="), DurationSeconds);
+	bExitOnReport = FParse::Param(CommandLine, TEXT("ParkourExitOnReport"));
+
+	FString RoutePath;
+	if (FParse::Value(CommandLine, TEXT("ParkourRoute="), RoutePath))
+	{
+		Route = LoadObject<UParkourRoute>(nullptr, *RoutePath);
+		if (Route == nullptr)
+		{
+			UE_LOG(LogParkourLoadTest, Warning, TEXT("Route '%s' was not found, using the built-in route"), *RoutePath);
+		}
+	}
+
+	// One Sample per Frame at Up to 120Hz, Reserved so that Measuring Does not Allocate
+	FrameTimesMs.Reserve(FMath::CeilToInt(DurationSeconds * 120.f));
+
+	SpawnBots(InWorld);
+	bRunning = true;
+
+	UE_LOG(LogParkourLoadTest, Display, TEXT("Load test started with %d bots, %.0fs warmup, %.0fs measured"), Bots.Num(), WarmupSeconds, DurationSeconds);
+}
+
+// Spawn Bots with Pawns at Player Starts
+void UParkourLoadTestSubsystem::SpawnBots(UWorld& InWorld)
+{
+	AGameModeBase* GameMode = InWorld.GetAuthGameMode();
+	if (GameMode == nullptr)
+	{
+		UE_LOG(LogParkourLoadTest, Error, TEXT("No game mode, bots cannot be spawned"));
+		return;
+	}
+
+	TArray<FTransform> SpawnTransforms;
+	for (TActorIterator<APlayerStart> It(&InWorld); It; ++It)
+	{
+		SpawnTransforms.Add(It->GetActorTransform());
+	}
+	if (SpawnTransforms.IsEmpty())
+	{
+		SpawnTransforms.Add(FTransform::Identity);
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	Bots.Reserve(NumBots);
+	for (int32 BotIndex = 0; BotIndex < NumBots; ++BotIndex)
+	{
+		AParkourBotController* Bot = InWorld.SpawnActor<AParkourBotController>(SpawnParams);
+		if (Bot == nullptr)
+		{
+			continue;
+		}
+		Bot->Route = Route;
+
+		// Spread Bots Sharing a Player Start on a Grid
+		FTransform SpawnTransform = SpawnTransforms[BotIndex % SpawnTransforms.Num()];
+		const int32 GridIndex = BotIndex / SpawnTransforms.Num();
+		SpawnTransform.AddToTranslation(FVector((GridIndex % 8) * 150.f, (GridIndex / 8) * 150.f, 0.f));
+
+		UClass* PawnClass = GameMode->GetDefaultPawnClassForController(Bot);
+		APawn* Pawn = PawnClass ? InWorld.SpawnActor<APawn>(PawnClass, SpawnTransform, SpawnParams) : nullptr;
+		if (Pawn == nullptr)
+		{
+			Bot->Destroy();
+			continue;
+		}
+
+		Bot->Possess(Pawn);
+		Bots.Add(Bot);
+	}
+}
+
+void UParkourLoadTestSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bRunning)
+	{
+		return;
+	}
+
+	ElapsedSeconds += DeltaTime;
+	if (ElapsedSeconds < WarmupSeconds)
+	{
+		return;
+	}
+
+	// Move Responses are Counted from the First Measured Frame
+	if (FrameTimesMs.IsEmpty())
+	{
+		UParkourCharacterMovementComponent::ResetMoveResponseStats();
+	}
+
+	// Server Waits for its Tick Rate, which is not Part of the Frame Cost
+	FrameTimesMs.Add(static_cast<float>((FApp::GetDeltaTime() - FApp::GetIdleTime()) * 1000.0));
+
+	// Replicated at the End of the Previous Frame, Which is Equally Representative
+	if (const UNetDriver* NetDriver = GetWorld()->GetNetDriver())
+	{
+		if (const UParkourReplicationGraph* ReplicationGraph = Cast<UParkourReplicationGraph>(NetDriver->GetReplicationDriver()))
+		{
+			NetTickTimesMs.Add(ReplicationGraph->GetLastReplicateMs());
+		}
+	}
+
+	if (ElapsedSeconds >= NextBandwidthSampleSeconds)
+	{
+		SampleBandwidth();
+		NextBandwidthSampleSeconds = ElapsedSeconds + 1.f;
+	}
+
+	if (ElapsedSeconds >= WarmupSeconds + DurationSeconds)
+	{
+		bRunning = false;
+		WriteReport();
+
+		if (bExitOnReport)
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+	}
+}
+
+TStatId UParkourLoadTestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UParkourLoadTestSubsystem, STATGROUP_Tickables);
+}
+
+// Sample Outgoing Bandwidth of Client Connections
+void UParkourLoadTestSubsystem::SampleBandwidth()
+{
+	UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if (NetDriver == nullptr || NetDriver->ClientConnections.IsEmpty())
+	{
+		return;
+	}
+
+	int64 OutBytesPerSecond = 0;
+	for (const UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		OutBytesPerSecond += Connection ? Connection->OutBytesPerSecond : 0;
+	}
+
+	OutBytesPerClientSum += static_cast<double>(OutBytesPerSecond) / NetDriver->ClientConnections.Num();
+	++NumBandwidthSamples;
+	MaxClientConnections = FMath::Max(MaxClientConnections, NetDriver->ClientConnections.Num());
+}
+
+// Log Results and Append Them to the CSV
+void UParkourLoadTestSubsystem::WriteReport()
+{
+	TArray<float> SortedFrameTimesMs = FrameTimesMs;
+	SortedFrameTimesMs.Sort();
+
+	const float P50 = ParkourLoadTest::Percentile(SortedFrameTimesMs, 0.5f);
+	const float P90 = ParkourLoadTest::Percentile(SortedFrameTimesMs, 0.9f);
+	const float P99 = ParkourLoadTest::Percentile(SortedFrameTimesMs, 0.99f);
+	const float Max = SortedFrameTimesMs.IsEmpty() ? 0.f : SortedFrameTimesMs.Last();
+	const double KBytesPerClient = NumBandwidthSamples > 0 ? OutBytesPerClientSum / NumBandwidthSamples / 1024.0 : 0.0;
+
+	TArray<float> SortedNetTickTimesMs = NetTickTimesMs;
+	SortedNetTickTimesMs.Sort();
+
+	const float NetP50 = ParkourLoadTest::Percentile(SortedNetTickTimesMs, 0.5f);
+	const float NetP99 = ParkourLoadTest::Percentile(SortedNetTickTimesMs, 0.99f);
+
+	// Only Remote Clients Send Moves, Bots Move on the Server and are Never Corrected
+	const FParkourMoveResponseStats& MoveStats = UParkourCharacterMovementComponent::GetMoveResponseStats();
+	const double CorrectionsPerClientPerSecond = MaxClientConnections > 0 && DurationSeconds > 0.f ? static_cast<double>(MoveStats.NumServerCorrections) / MaxClientConnections / DurationSeconds : 0.0;
+	const double CorrectionPercent = MoveStats.NumServerResponses > 0 ? 100.0 * MoveStats.NumServerCorrections / MoveStats.NumServerResponses : 0.0;
+
+	// Server Target Compiles Cosmetics Out, Compared Against the Game Target Run with -server
+	const TCHAR* const TargetName = UE_SERVER ? TEXT("Server") : TEXT("Game");
+	const double BinaryMB = static_cast<double>(FMath::Max<int64>(IFileManager::Get().FileSize(FPlatformProcess::ExecutablePath()), 0)) / (1024.0 * 1024.0);
+
+	UE_LOG(LogParkourLoadTest, Display, TEXT("Load test: %d bots, %d clients, %d frames, frame ms p50 %.2f p90 %.2f p99 %.2f max %.2f, %.2f KB/s out per client"),
+		Bots.Num(), MaxClientConnections, FrameTimesMs.Num(), P50, P90, P99, Max, KBytesPerClient);
+
+	UE_LOG(LogParkourLoadTest, Display, TEXT("Build: %s target, cosmetics %s, executable %.1f MB"),
+		TargetName, PARKOUR_WITH_COSMETICS ? TEXT("on") : TEXT("off"), BinaryMB);
+
+	UE_LOG(LogParkourLoadTest, Display, TEXT("Moves: %lld responses, %lld corrections (%.2f%%), %.2f corrections/s per client"),
+		MoveStats.NumServerResponses, MoveStats.NumServerCorrections, CorrectionPercent, CorrectionsPerClientPerSecond);
+
+	if (NetTickTimesMs.Num() > 0)
+	{
+		UE_LOG(LogParkourLoadTest, Display, TEXT("Replication graph: net tick ms p50 %.2f p99 %.2f"), NetP50, NetP99);
+	}
+	else
+	{
+		UE_LOG(LogParkourLoadTest, Display, TEXT("Replication graph not in use, net tick time not measured"));
+	}
+
+	if (FParkourLatencyTracker::IsEnabled())
+	{
+		FParkourLatencyTracker::Get().Report();
+	}
+
+	const FString CsvPath = FPaths::ProfilingDir() / TEXT("ParkourLoadTest.csv");
+	if (!IFileManager::Get().FileExists(*CsvPath))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Bots,Clients,Frames,P50Ms,P90Ms,P99Ms,MaxMs,OutKBPerSecPerClient,NetP50Ms,NetP99Ms,Target,BinaryMB,MoveResponses,Corrections,CorrectionsPerSecPerClient\n"), *CsvPath);
+	}
+
+	const FString Row = FString::Printf(TEXT("%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%s,%.1f,%lld,%lld,%.3f\n"),
+		Bots.Num(), MaxClientConnections, FrameTimesMs.Num(), P50, P90, P99, Max, KBytesPerClient, NetP50, NetP99, TargetName, BinaryMB,
+		MoveStats.NumServerResponses, MoveStats.NumServerCorrections, CorrectionsPerClientPerSecond);
+	FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
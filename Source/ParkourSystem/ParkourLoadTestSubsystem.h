@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ParkourLoadTestSubsystem.generated.h"
+
+class AParkourBotController;
+class UParkourRoute;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogParkourLoadTest, Log, All);
+
+/**
+ * Headless load test, created only when the server is launched with -ParkourLoadTest.
+ * Spawns bots running a parkour route and reports server frame time percentiles, bandwidth per client,
+ * and how many of the server's move responses corrected a client.
+ *
+ * Options:
+ *   -ParkourBots=K              Number of bots (default 8)
+ *   -ParkourRoute=<ObjectPath>  UParkourRoute asset, built-in route if omitted
+ *   -ParkourWarmup=Seconds      Seconds ignored before measuring (default 5)
+ *   -ParkourDuration=Seconds    Seconds measured (default 60)
+ *   -ParkourExitOnReport        Quit after writing the report
+ *
+ * Each run appends a row to Saved/Profiling/ParkourLoadTest.csv, so sweeping K from 8 to 128 is one run per K,
+ * e.g. "<Server> <Map> -server -nullrhi -ParkourLoadTest -ParkourBots=64 -ParkourExitOnReport" with loopback clients
+ * connecting to 127.0.0.1.
+ * Net tick time is reported while UParkourReplicationGraph drives replication. To compare against the default relevancy,
+ * run the same K with -ini:Engine:[/Script/OnlineSubsystemUtils.IpNetDriver]:ReplicationDriverClassName= and compare frame times.
+ * With parkour.LatencyTrace set, bot presses are reported apart from player presses: bots call the actions directly,
+ * so their latencies exclude Enhanced Input processing.
+ * Rows record the target and executable size, so running the same K with ParkourSystemServer and with the game
+ * target started with -server compares the server build, which compiles out cosmetics, against the client build.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourLoadTestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UParkourLoadTestSubsystem();
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// End of FTickableGameObject interface
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Spawn Bots with Pawns at Player Starts
+	void SpawnBots(UWorld& InWorld);
+
+	// Sample Outgoing Bandwidth of Client Connections
+	void SampleBandwidth();
+
+	// Log Results and Append Them to the CSV
+	void WriteReport();
+
+	UPROPERTY()
+	TArray<AParkourBotController*> Bots;
+
+	UPROPERTY()
+	UParkourRoute* Route;
+
+	int32 NumBots;
+
+	float WarmupSeconds;
+
+	float DurationSeconds;
+
+	float ElapsedSeconds;
+
+	float NextBandwidthSampleSeconds;
+
+	bool bExitOnReport;
+
+	bool bRunning;
+
+	// Game Thread Time of Each Measured Frame, Excluding Idle Time
+	TArray<float> FrameTimesMs;
+
+	// Time of Each Measured Frame Spent in UParkourReplicationGraph::ServerReplicateActors
+	TArray<float> NetTickTimesMs;
+
+	double OutBytesPerClientSum;
+
+	int32 NumBandwidthSamples;
+
+	int32 MaxClientConnections;
+};
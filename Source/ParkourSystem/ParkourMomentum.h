@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourMomentum.generated.h"
+
+/**
+ * Stats of a single slide -> jump -> land -> slide chain, for telemetry and benchmarks.
+ */
+USTRUCT(BlueprintType)
+struct FParkourChainStats
+{
+	GENERATED_BODY()
+
+	// Number of Links (Slide Jumps, Sprint Jumps and Landed Slides) in the Chain
+	UPROPERTY(BlueprintReadOnly, Category = Momentum)
+	int32 NumLinks = 0;
+
+	// Highest Speed Carried into a Link
+	UPROPERTY(BlueprintReadOnly, Category = Momentum)
+	float PeakSpeed = 0.f;
+
+	// Sum of Speeds Carried into Links
+	UPROPERTY(BlueprintReadOnly, Category = Momentum)
+	float TotalCarriedSpeed = 0.f;
+
+	// Sum of Speeds Discarded by the Speed Budget
+	UPROPERTY(BlueprintReadOnly, Category = Momentum)
+	float BudgetClampedSpeed = 0.f;
+
+	// World Time When the Chain Started
+	UPROPERTY(BlueprintReadOnly, Category = Momentum)
+	double StartTime = 0.0;
+
+	// Length of the Chain in Seconds, Set When the Chain Ends
+	UPROPERTY(BlueprintReadOnly, Category = Momentum)
+	float Duration = 0.f;
+};
+
+/**
+ * Horizontal speed carried through chained parkour actions, bounded by a speed budget.
+ * Fixed size and free of randomness, so the same inputs always give the same chain.
+ */
+struct FParkourMomentum
+{
+	// Carry Horizontal Speed into the Next Link
+	//! @return Speed Carried, Never Above SpeedBudget
+	float AddLink(float HorizontalSpeed, float BonusSpeed, float CarryRatio, float SpeedBudget, double Now)
+	{
+		const float DesiredSpeed = HorizontalSpeed * CarryRatio + BonusSpeed;
+		CarriedSpeed = FMath::Min(DesiredSpeed, SpeedBudget);
+
+		if (CurrentChain.NumLinks == 0)
+		{
+			CurrentChain.StartTime = Now;
+		}
+
+		++CurrentChain.NumLinks;
+		CurrentChain.PeakSpeed = FMath::Max(CurrentChain.PeakSpeed, CarriedSpeed);
+		CurrentChain.TotalCarriedSpeed += CarriedSpeed;
+		CurrentChain.BudgetClampedSpeed += FMath::Max(DesiredSpeed - SpeedBudget, 0.f);
+
+		return CarriedSpeed;
+	}
+
+	// Finish the Chain and Keep Its Stats as the Last Chain
+	void EndChain(double Now)
+	{
+		if (CurrentChain.NumLinks > 0)
+		{
+			CurrentChain.Duration = static_cast<float>(Now - CurrentChain.StartTime);
+			LastChain = CurrentChain;
+		}
+
+		CurrentChain = FParkourChainStats();
+		CarriedSpeed = 0.f;
+	}
+
+	bool IsChainActive() const { return CurrentChain.NumLinks > 0; }
+
+	float GetCarriedSpeed() const { return CarriedSpeed; }
+
+	const FParkourChainStats& GetCurrentChain() const { return CurrentChain; }
+
+	const FParkourChainStats& GetLastChain() const { return LastChain; }
+
+private:
+	FParkourChainStats CurrentChain;
+
+	FParkourChainStats LastChain;
+
+	float CarriedSpeed = 0.f;
+};
@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourNavLinkData.h"
+
+TSubclassOf<UNavArea> UParkourNavLinkData::GetAreaClass(EParkourNavLink Type)
+{
+	switch (Type)
+	{
+	case EParkourNavLink::EPNL_CrouchTunnel:
+		return UParkourNavArea_CrouchTunnel::StaticClass();
+	case EParkourNavLink::EPNL_DoubleJump:
+		return UParkourNavArea_DoubleJump::StaticClass();
+	default:
+		return nullptr;
+	}
+}
+
+UParkourNavArea_CrouchTunnel::UParkourNavArea_CrouchTunnel()
+{
+	// Crouching is Slower than Walking
+	DefaultCost = 2.f;
+	DrawColor = FColor(255, 160, 0);
+}
+
+UParkourNavArea_DoubleJump::UParkourNavArea_DoubleJump()
+{
+	DefaultCost = 1.5f;
+	DrawColor = FColor(0, 200, 255);
+}
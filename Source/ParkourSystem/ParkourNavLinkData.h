@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NavAreas/NavArea.h"
+#include "ParkourNavLinkData.generated.h"
+
+UENUM(BlueprintType)
+enum class EParkourNavLink : uint8
+{
+	EPNL_CrouchTunnel,
+	EPNL_DoubleJump
+};
+
+/**
+ * One precomputed parkour traversal, stored in world space.
+ */
+USTRUCT(BlueprintType)
+struct FParkourNavLink
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = NavLink)
+	FVector3f Start = FVector3f::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = NavLink)
+	FVector3f End = FVector3f::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = NavLink)
+	EParkourNavLink Type = EParkourNavLink::EPNL_CrouchTunnel;
+};
+
+/**
+ * Parkour nav links of a level, generated offline by AParkourNavLinkProxy::BuildLinks().
+ * Loading it costs no traces; the links go straight into the nav mesh.
+ */
+UCLASS(BlueprintType)
+class PARKOURSYSTEM_API UParkourNavLinkData : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = NavLink)
+	TArray<FParkourNavLink> Links;
+
+	// Nav Area a Link Type is Marked With, so that UParkourPathFollowingComponent Knows Which Action to Take
+	static TSubclassOf<UNavArea> GetAreaClass(EParkourNavLink Type);
+};
+
+// Crouch Under an Obstacle the Standing Capsule Does Not Fit Under
+UCLASS()
+class PARKOURSYSTEM_API UParkourNavArea_CrouchTunnel : public UNavArea
+{
+	GENERATED_BODY()
+
+public:
+	UParkourNavArea_CrouchTunnel();
+};
+
+// Jump over a Gap That Needs the Double Jump
+UCLASS()
+class PARKOURSYSTEM_API UParkourNavArea_DoubleJump : public UNavArea
+{
+	GENERATED_BODY()
+
+public:
+	UParkourNavArea_DoubleJump();
+};
@@ -0,0 +1,252 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourNavLinkProxy.h"
+#include "ParkourNavLinkData.h"
+#include "ParkourSystemCharacter.h"
+#include "ParkourTuning.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "NavigationSystem.h"
+#include "NavMesh/RecastNavMesh.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogParkourNavLink, Log, All);
+
+AParkourNavLinkProxy::AParkourNavLinkProxy()
+	: LinkData(nullptr)
+	, Tuning(nullptr)
+	, CharacterClass(AParkourSystemCharacter::StaticClass())
+	, MaxTunnelLength(400.f)
+	, GapProbeStep(25.f)
+{
+	// Links Come from LinkData Only
+	PointLinks.Empty();
+	bSmartLinkIsRelevant = false;
+}
+
+// Links Must be in Place Before Registering with the Navigation System
+void AParkourNavLinkProxy::PostRegisterAllComponents()
+{
+	RefreshPointLinks();
+
+	Super::PostRegisterAllComponents();
+}
+
+void AParkourNavLinkProxy::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	RefreshPointLinks();
+}
+
+// Convert LinkData into Point Links Relative to This Actor
+void AParkourNavLinkProxy::RefreshPointLinks()
+{
+	PointLinks.Reset();
+
+	if (LinkData == nullptr)
+	{
+		return;
+	}
+
+	const FTransform& ActorTransform = GetActorTransform();
+
+	PointLinks.Reserve(LinkData->Links.Num());
+	for (const FParkourNavLink& Link : LinkData->Links)
+	{
+		FNavigationLink& PointLink = PointLinks.AddDefaulted_GetRef();
+		PointLink.Left = ActorTransform.InverseTransformPosition(FVector(Link.Start));
+		PointLink.Right = ActorTransform.InverseTransformPosition(FVector(Link.End));
+
+		// Tunnels can be Crouched Through Both Ways, Gaps are Probed from Each Side Separately
+		PointLink.Direction = Link.Type == EParkourNavLink::EPNL_CrouchTunnel ? ENavLinkDirection::BothWays : ENavLinkDirection::LeftToRight;
+		PointLink.SetAreaClass(UParkourNavLinkData::GetAreaClass(Link.Type));
+	}
+}
+
+#if WITH_EDITOR
+// Analyze Nav Mesh and Level Geometry, Then Write Links into LinkData
+void AParkourNavLinkProxy::BuildLinks()
+{
+#if WITH_RECAST
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	const ARecastNavMesh* NavMesh = NavSys ? Cast<ARecastNavMesh>(NavSys->GetDefaultNavDataInstance()) : nullptr;
+
+	if (LinkData == nullptr || NavMesh == nullptr)
+	{
+		UE_LOG(LogParkourNavLink, Warning, TEXT("%s: BuildLinks needs LinkData and a built nav mesh."), *GetName());
+		return;
+	}
+
+	const UParkourTuning& ParkourTuning = Tuning ? *Tuning : *GetDefault<UParkourTuning>();
+	const AParkourSystemCharacter* Character = CharacterClass ? CharacterClass->GetDefaultObject<AParkourSystemCharacter>() : GetDefault<AParkourSystemCharacter>();
+	const UCharacterMovementComponent* Movement = Character->GetCharacterMovement();
+
+	const float Radius = Character->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
+	const float StandingHalfHeight = Character->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	const float CrouchHalfHeight = ParkourTuning.CrouchCapsuleHalfHeight;
+	const float Gravity = FMath::Max(FMath::Abs(World->GetGravityZ() * Movement->GravityScale), UE_KINDA_SMALL_NUMBER);
+
+	// Reach of a Jump, and of a Double Jump Launched at Its Apex
+	const float JumpZ = Movement->JumpZVelocity;
+	const float RiseTime = JumpZ / Gravity;
+	const float JumpHeight = FMath::Square(JumpZ) / (2.f * Gravity);
+	const float JumpLength = Movement->MaxWalkSpeed * 2.f * RiseTime;
+	const float DoubleJumpHeight = JumpHeight + FMath::Square(ParkourTuning.VerticalJumpForce) / (2.f * Gravity);
+	const float DoubleJumpFallTime = (ParkourTuning.VerticalJumpForce + FMath::Sqrt(FMath::Square(ParkourTuning.VerticalJumpForce) + 2.f * Gravity * JumpHeight)) / Gravity;
+	const float DoubleJumpLength = Movement->MaxWalkSpeed * RiseTime + (Movement->MaxWalkSpeed + ParkourTuning.HorizontalJumpForce) * DoubleJumpFallTime;
+
+	const FCollisionShape StandingShape = FCollisionShape::MakeCapsule(Radius, StandingHalfHeight);
+	const FCollisionShape CrouchShape = FCollisionShape::MakeCapsule(Radius, CrouchHalfHeight);
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(ParkourNavLinkBuild), false, this);
+	const FVector Up = FVector::UpVector;
+
+	// Probe Just Outside an Edge, an Edge is a Border If It Projects onto Nothing
+	const float EdgeProbeOffset = 10.f;
+	const FVector EdgeProbeExtent(EdgeProbeOffset * 0.5f, EdgeProbeOffset * 0.5f, StandingHalfHeight);
+	const FVector LandingExtent(GapProbeStep * 0.5f, GapProbeStep * 0.5f, DoubleJumpHeight);
+
+	// Links Found from Neighbouring Edges Collapse into One
+	const float CellSize = Radius * 2.f;
+	auto ToCell = [CellSize](const FVector& Location)
+	{
+		return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize), FMath::FloorToInt(Location.Z / CellSize));
+	};
+	TSet<TPair<FIntVector, FIntVector>> Seen;
+
+	TArray<FParkourNavLink> Links;
+	int32 NumTunnels = 0;
+	int32 NumGaps = 0;
+
+	auto AddLink = [&](const FVector& Start, const FVector& End, EParkourNavLink Type)
+	{
+		bool bAlreadySeen = false;
+		Seen.Add(TPair<FIntVector, FIntVector>(ToCell(Start), ToCell(End)), &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			return;
+		}
+
+		// Skip If Already Walkable
+		FVector HitLocation;
+		if (!UNavigationSystemV1::NavigationRaycast(World, Start, End, HitLocation))
+		{
+			return;
+		}
+
+		FParkourNavLink& Link = Links.AddDefaulted_GetRef();
+		Link.Start = FVector3f(Start);
+		Link.End = FVector3f(End);
+		Link.Type = Type;
+		Type == EParkourNavLink::EPNL_CrouchTunnel ? ++NumTunnels : ++NumGaps;
+	};
+
+	TArray<FNavPoly> Polys;
+	TArray<FVector> Verts;
+	FNavLocation Projected;
+	FHitResult Hit;
+
+	for (int32 TileIndex = 0; TileIndex < NavMesh->GetNavMeshTilesCount(); ++TileIndex)
+	{
+		Polys.Reset();
+		NavMesh->GetPolysInTile(TileIndex, Polys);
+
+		for (const FNavPoly& Poly : Polys)
+		{
+			Verts.Reset();
+			NavMesh->GetPolyVerts(Poly.Ref, Verts);
+
+			for (int32 VertIndex = 0; VertIndex < Verts.Num(); ++VertIndex)
+			{
+				const FVector& A = Verts[VertIndex];
+				const FVector& B = Verts[(VertIndex + 1) % Verts.Num()];
+				const FVector EdgeCenter = (A + B) * 0.5f;
+
+				FVector Outward = FVector::CrossProduct(B - A, Up).GetSafeNormal2D();
+				if ((Outward | (EdgeCenter - Poly.Center)) < 0.f)
+				{
+					Outward = -Outward;
+				}
+
+				if (NavSys->ProjectPointToNavigation(EdgeCenter + Outward * EdgeProbeOffset, Projected, EdgeProbeExtent, NavMesh))
+				{
+					continue;
+				}
+
+				const FVector Probe = EdgeCenter + Outward * (Radius + EdgeProbeOffset);
+				const bool bStandingBlocked = World->OverlapBlockingTestByChannel(Probe + Up * StandingHalfHeight, FQuat::Identity, ECC_Pawn, StandingShape, Params);
+				const bool bCrouchBlocked = World->OverlapBlockingTestByChannel(Probe + Up * CrouchHalfHeight, FQuat::Identity, ECC_Pawn, CrouchShape, Params);
+
+				// Crouch Tunnel, Walk Forward Crouched Until Standing Fits Again
+				if (bStandingBlocked && !bCrouchBlocked)
+				{
+					for (float Distance = Radius + EdgeProbeOffset; Distance <= MaxTunnelLength; Distance += GapProbeStep)
+					{
+						const FVector Inside = EdgeCenter + Outward * Distance;
+						if (World->OverlapBlockingTestByChannel(Inside + Up * CrouchHalfHeight, FQuat::Identity, ECC_Pawn, CrouchShape, Params))
+						{
+							break;
+						}
+
+						if (!World->OverlapBlockingTestByChannel(Inside + Up * StandingHalfHeight, FQuat::Identity, ECC_Pawn, StandingShape, Params))
+						{
+							if (NavSys->ProjectPointToNavigation(Inside, Projected, EdgeProbeExtent, NavMesh))
+							{
+								AddLink(EdgeCenter, Projected.Location, EParkourNavLink::EPNL_CrouchTunnel);
+							}
+							break;
+						}
+					}
+					continue;
+				}
+
+				// Gap, Only When There is No Floor Within a Capsule Height Below the Edge
+				if (bCrouchBlocked || World->LineTraceTestByChannel(Probe, Probe - Up * StandingHalfHeight * 2.f, ECC_Pawn, Params))
+				{
+					continue;
+				}
+
+				for (float Distance = GapProbeStep; Distance <= DoubleJumpLength; Distance += GapProbeStep)
+				{
+					if (!NavSys->ProjectPointToNavigation(EdgeCenter + Outward * Distance, Projected, LandingExtent, NavMesh))
+					{
+						continue;
+					}
+
+					const FVector Landing = Projected.Location;
+					const float Rise = Landing.Z - EdgeCenter.Z;
+					const float Length = FVector::Dist2D(EdgeCenter, Landing);
+
+					// Out of Reach, or Reachable Without the Double Jump
+					if (Rise > DoubleJumpHeight || Length > DoubleJumpLength || (Rise <= JumpHeight && Length <= JumpLength))
+					{
+						break;
+					}
+
+					// Clearance of the Arc, Approximated by Up Then Across
+					const FVector Apex = FVector(EdgeCenter.X, EdgeCenter.Y, FMath::Max(EdgeCenter.Z, Landing.Z) + StandingHalfHeight);
+					const bool bArcBlocked =
+						World->SweepSingleByChannel(Hit, EdgeCenter + Up * StandingHalfHeight, Apex, FQuat::Identity, ECC_Pawn, StandingShape, Params) ||
+						World->SweepSingleByChannel(Hit, Apex, FVector(Landing.X, Landing.Y, Apex.Z), FQuat::Identity, ECC_Pawn, StandingShape, Params);
+
+					if (!bArcBlocked)
+					{
+						AddLink(EdgeCenter, Landing, EParkourNavLink::EPNL_DoubleJump);
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	LinkData->Modify();
+	LinkData->Links = MoveTemp(Links);
+
+	RefreshPointLinks();
+	UNavigationSystemV1::UpdateActorInNavOctree(*this);
+
+	UE_LOG(LogParkourNavLink, Log, TEXT("%s: Built %d crouch tunnels and %d double jump gaps into %s."), *GetName(), NumTunnels, NumGaps, *LinkData->GetName());
+#endif
+}
+#endif
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Navigation/NavLinkProxy.h"
+#include "ParkourNavLinkProxy.generated.h"
+
+class AParkourSystemCharacter;
+class UParkourNavLinkData;
+class UParkourTuning;
+
+/**
+ * Feeds the parkour nav links of a level into the nav mesh.
+ * In the editor, BuildLinks analyzes the nav mesh and level geometry once and writes the result into LinkData.
+ * Links are plain point links marked with parkour nav areas; AParkourBotController crosses them through UParkourPathFollowingComponent.
+ */
+UCLASS()
+class PARKOURSYSTEM_API AParkourNavLinkProxy : public ANavLinkProxy
+{
+	GENERATED_BODY()
+
+public:
+	AParkourNavLinkProxy();
+
+	// Links Fed into the Nav Mesh, Written by BuildLinks
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Parkour)
+	UParkourNavLinkData* LinkData;
+
+	// Tuning Links are Sized by, Default Values are Used If Not Set
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Parkour)
+	UParkourTuning* Tuning;
+
+	// Character Whose Capsule and Movement Links are Sized by
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Parkour)
+	TSubclassOf<AParkourSystemCharacter> CharacterClass;
+
+	// Longest Tunnel Probed for Crouching
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Parkour, meta = (ClampMin = "0"))
+	float MaxTunnelLength;
+
+	// Distance Between Gap Probes
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Parkour, meta = (ClampMin = "10"))
+	float GapProbeStep;
+
+#if WITH_EDITOR
+	// Analyze Nav Mesh and Level Geometry, Then Write Links into LinkData
+	UFUNCTION(CallInEditor, Category = Parkour)
+	void BuildLinks();
+#endif
+
+	virtual void PostRegisterAllComponents() override;
+
+	virtual void OnConstruction(const FTransform& Transform) override;
+
+protected:
+	// Convert LinkData into Point Links Relative to This Actor
+	void RefreshPointLinks();
+};
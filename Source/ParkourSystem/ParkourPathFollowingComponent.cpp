@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourPathFollowingComponent.h"
+#include "ParkourNavLinkData.h"
+#include "ParkourSystemCharacter.h"
+#include "AIController.h"
+#include "NavigationData.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+UParkourPathFollowingComponent::UParkourPathFollowingComponent()
+	: SegmentLinkArea(nullptr)
+{
+	bCrouchedForLink = false;
+	bDoubleJumpPending = false;
+	bJumpHeld = false;
+}
+
+// Character Following the Path, Null for Any Other Pawn
+AParkourSystemCharacter* UParkourPathFollowingComponent::GetParkourCharacter() const
+{
+	return MovementComp ? Cast<AParkourSystemCharacter>(MovementComp->GetOwner()) : nullptr;
+}
+
+// Area of the Nav Link a Path Segment Starts on, Null Off Links
+const UClass* UParkourPathFollowingComponent::GetLinkAreaClass(int32 SegmentStartIndex) const
+{
+	if (!Path.IsValid() || !Path->GetPathPoints().IsValidIndex(SegmentStartIndex))
+	{
+		return nullptr;
+	}
+
+	// Point Flags Carry the Area of the Segment After the Point
+	const FNavMeshNodeFlags Flags(Path->GetPathPoints()[SegmentStartIndex].Flags);
+	const ANavigationData* NavData = Path->GetNavigationDataUsed();
+	if (!Flags.IsNavLink() || NavData == nullptr)
+	{
+		return nullptr;
+	}
+
+	return NavData->GetAreaClass(Flags.Area);
+}
+
+void UParkourPathFollowingComponent::SetMoveSegment(int32 SegmentStartIndex)
+{
+	Super::SetMoveSegment(SegmentStartIndex);
+
+	AParkourSystemCharacter* Character = GetParkourCharacter();
+	if (Character == nullptr)
+	{
+		return;
+	}
+
+	SegmentLinkArea = GetLinkAreaClass(MoveSegmentStartIndex);
+
+	if (SegmentLinkArea == UParkourNavArea_CrouchTunnel::StaticClass())
+	{
+		// Crouching Starts Only from Walking
+		Character->SprintEnd();
+		Character->SlideEnd();
+		Character->CrouchStart();
+		bCrouchedForLink = Character->GetParkourState().CurrentParkourMode == EParkourMode::EPM_Crouch;
+	}
+	else if (SegmentLinkArea == UParkourNavArea_DoubleJump::StaticClass())
+	{
+		// Both Jumps Launch Along the Character's Facing, so Face the Link End Before the First
+		if (AAIController* AIOwner = Cast<AAIController>(GetOwner()))
+		{
+			AIOwner->SetFocalPoint(GetCurrentTargetLocation(), EAIFocusPriority::Move);
+			AIOwner->UpdateControlRotation(0.f, true);
+		}
+
+		Character->Jump();
+		bJumpHeld = true;
+		bDoubleJumpPending = true;
+	}
+}
+
+void UParkourPathFollowingComponent::FollowPathSegment(float DeltaTime)
+{
+	Super::FollowPathSegment(DeltaTime);
+
+	AParkourSystemCharacter* Character = GetParkourCharacter();
+	if (Character == nullptr)
+	{
+		return;
+	}
+
+	if (bJumpHeld)
+	{
+		Character->StopJumping();
+		bJumpHeld = false;
+	}
+
+	// Double Jump Links are Sized for the Second Jump at the Apex of the First
+	if (bDoubleJumpPending && Character->GetCharacterMovement()->IsFalling() && Character->GetVelocity().Z <= 0.f)
+	{
+		Character->Jump();
+		bJumpHeld = true;
+		bDoubleJumpPending = false;
+	}
+
+	// Stand up as Soon as the Tunnel Lets Go
+	if (bCrouchedForLink && SegmentLinkArea != UParkourNavArea_CrouchTunnel::StaticClass())
+	{
+		Character->CrouchEnd();
+		bCrouchedForLink = Character->GetParkourState().CurrentParkourMode == EParkourMode::EPM_Crouch;
+	}
+}
+
+void UParkourPathFollowingComponent::OnPathFinished(const FPathFollowingResult& Result)
+{
+	ResetLinkActions();
+
+	Super::OnPathFinished(Result);
+}
+
+// Stand up and Forget Pending Actions
+void UParkourPathFollowingComponent::ResetLinkActions()
+{
+	if (AParkourSystemCharacter* Character = GetParkourCharacter())
+	{
+		if (bJumpHeld)
+		{
+			Character->StopJumping();
+		}
+		if (bCrouchedForLink)
+		{
+			Character->CrouchEnd();
+		}
+	}
+
+	SegmentLinkArea = nullptr;
+	bCrouchedForLink = false;
+	bDoubleJumpPending = false;
+	bJumpHeld = false;
+}
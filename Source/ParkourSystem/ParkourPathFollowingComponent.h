@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "ParkourPathFollowingComponent.generated.h"
+
+class AParkourSystemCharacter;
+
+/**
+ * Path following that takes the parkour action a nav link's area asks for when a path segment starts on one.
+ * Crouch tunnel links are crossed crouched, standing up again once past them, and double jump links are
+ * jumped from their start with the second jump at the apex, as AParkourNavLinkProxy::BuildLinks sized them.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourPathFollowingComponent : public UPathFollowingComponent
+{
+	GENERATED_BODY()
+
+public:
+	UParkourPathFollowingComponent();
+
+protected:
+	virtual void SetMoveSegment(int32 SegmentStartIndex) override;
+
+	virtual void FollowPathSegment(float DeltaTime) override;
+
+	virtual void OnPathFinished(const FPathFollowingResult& Result) override;
+
+	// Character Following the Path, Null for Any Other Pawn
+	AParkourSystemCharacter* GetParkourCharacter() const;
+
+	// Area of the Nav Link a Path Segment Starts on, Null Off Links
+	const UClass* GetLinkAreaClass(int32 SegmentStartIndex) const;
+
+	// Stand up and Forget Pending Actions
+	void ResetLinkActions();
+
+	// Area of the Nav Link the Current Segment Crosses
+	const UClass* SegmentLinkArea;
+
+	// Crouched for a Tunnel, Standing up Once Out of It
+	uint8 bCrouchedForLink : 1;
+
+	// Second Jump Waits for the Apex
+	uint8 bDoubleJumpPending : 1;
+
+	// Jump Pressed Last Frame, Released This Frame
+	uint8 bJumpHeld : 1;
+};
@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourProjectileHitSubsystem.h"
+#include "ParkourSystemProjectile.h"
+#include "Components/PrimitiveComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Flush Projectile Impulses"), STAT_ParkourFlushImpulses, STATGROUP_Game);
+
+void UParkourProjectileHitSubsystem::QueueImpulse(UPrimitiveComponent* Component, const FVector& Impulse, const FVector& Location)
+{
+	QueuedImpulses.Add({ Component, Impulse, Location });
+}
+
+void UParkourProjectileHitSubsystem::QueueRetire(AParkourSystemProjectile* Projectile)
+{
+	QueuedRetired.Add(Projectile);
+}
+
+void UParkourProjectileHitSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushImpulses();
+	FlushRetired();
+}
+
+TStatId UParkourProjectileHitSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UParkourProjectileHitSubsystem, STATGROUP_Tickables);
+}
+
+void UParkourProjectileHitSubsystem::Deinitialize()
+{
+	QueuedImpulses.Empty();
+	QueuedRetired.Empty();
+
+	Super::Deinitialize();
+}
+
+// Apply Queued Impulses
+void UParkourProjectileHitSubsystem::FlushImpulses()
+{
+	if (QueuedImpulses.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ParkourFlushImpulses);
+
+	// Group Hits on the Same Component so that Each Body is Touched Once
+	QueuedImpulses.Sort([](const FQueuedImpulse& A, const FQueuedImpulse& B)
+	{
+		return A.Component.Get() < B.Component.Get();
+	});
+
+	int32 GroupStart = 0;
+	while (GroupStart < QueuedImpulses.Num())
+	{
+		UPrimitiveComponent* Component = QueuedImpulses[GroupStart].Component.Get();
+
+		int32 GroupEnd = GroupStart + 1;
+		while (GroupEnd < QueuedImpulses.Num() && QueuedImpulses[GroupEnd].Component.Get() == Component)
+		{
+			++GroupEnd;
+		}
+
+		if (Component != nullptr && Component->IsSimulatingPhysics())
+		{
+			if (GroupEnd - GroupStart == 1)
+			{
+				Component->AddImpulseAtLocation(QueuedImpulses[GroupStart].Impulse, QueuedImpulses[GroupStart].Location);
+			}
+			else
+			{
+				// Impulses at Different Points Sum up to One Linear and One Angular Impulse About the Center of Mass
+				const FVector CenterOfMass = Component->GetCenterOfMass();
+
+				FVector LinearImpulse = FVector::ZeroVector;
+				FVector AngularImpulse = FVector::ZeroVector;
+				for (int32 Index = GroupStart; Index < GroupEnd; ++Index)
+				{
+					const FQueuedImpulse& Queued = QueuedImpulses[Index];
+					LinearImpulse += Queued.Impulse;
+					AngularImpulse += FVector::CrossProduct(Queued.Location - CenterOfMass, Queued.Impulse);
+				}
+
+				Component->AddImpulse(LinearImpulse);
+				Component->AddAngularImpulseInRadians(AngularImpulse);
+			}
+		}
+
+		GroupStart = GroupEnd;
+	}
+
+	QueuedImpulses.Reset();
+}
+
+// Destroy Queued Projectiles
+void UParkourProjectileHitSubsystem::FlushRetired()
+{
+	for (const TWeakObjectPtr<AParkourSystemProjectile>& Projectile : QueuedRetired)
+	{
+		if (Projectile.IsValid())
+		{
+			Projectile->Destroy();
+		}
+	}
+
+	QueuedRetired.Reset();
+}
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ParkourProjectileHitSubsystem.generated.h"
+
+class AParkourSystemProjectile;
+class UPrimitiveComponent;
+
+/**
+ * Collects projectile hit impulses and retired projectiles during the frame,
+ * then applies them in one batched pass after physics has run.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourProjectileHitSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Queue an Impulse to be Applied at the End of the Frame
+	void QueueImpulse(UPrimitiveComponent* Component, const FVector& Impulse, const FVector& Location);
+
+	// Queue a Projectile to be Destroyed at the End of the Frame
+	void QueueRetire(AParkourSystemProjectile* Projectile);
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// End of FTickableGameObject interface
+
+	virtual void Deinitialize() override;
+
+protected:
+	// Apply Queued Impulses, Merged per Component
+	void FlushImpulses();
+
+	// Destroy Queued Projectiles
+	void FlushRetired();
+
+private:
+	struct FQueuedImpulse
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		FVector Impulse;
+		FVector Location;
+	};
+
+	TArray<FQueuedImpulse> QueuedImpulses;
+
+	TArray<TWeakObjectPtr<AParkourSystemProjectile>> QueuedRetired;
+};
@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourProjectileMovementComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarParkourProjectileBroadphase(
+	TEXT("parkour.ProjectileBroadphase"),
+	true,
+	TEXT("Check the volume projectiles sweep before simulating them, moving without sweeps when clear and substepping when not."));
+
+FParkourProjectileQueryStats UParkourProjectileMovementComponent::QueryStats;
+
+UParkourProjectileMovementComponent::UParkourProjectileMovementComponent()
+	: MaxSubstepDistance(100.f)
+{
+	bWantsInitializeComponent = true;
+}
+
+void UParkourProjectileMovementComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+
+	// Overlaps Along the Path are Only Generated by Swept Moves, so Objects the Projectile Overlaps Count as Surfaces too
+	PathObjectTypes = FCollisionObjectQueryParams();
+	if (const UPrimitiveComponent* UpdatedPrimitive = Cast<UPrimitiveComponent>(UpdatedComponent))
+	{
+		const bool bGenerateOverlapEvents = UpdatedPrimitive->GetGenerateOverlapEvents();
+		for (int32 Channel = 0; Channel < ECC_MAX; ++Channel)
+		{
+			const ECollisionResponse Response = UpdatedPrimitive->GetCollisionResponseToChannel(static_cast<ECollisionChannel>(Channel));
+			if (Response == ECR_Block || (Response == ECR_Overlap && bGenerateOverlapEvents))
+			{
+				PathObjectTypes.AddObjectTypesToQuery(static_cast<ECollisionChannel>(Channel));
+			}
+		}
+	}
+}
+
+void UParkourProjectileMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	const bool bUseBroadphase = CVarParkourProjectileBroadphase.GetValueOnGameThread()
+		&& PathObjectTypes.IsValid()
+		&& UpdatedComponent != nullptr
+		&& bSimulationEnabled
+		&& !UpdatedComponent->IsSimulatingPhysics()
+		&& !bIsHomingProjectile
+		&& !bInterpMovement
+		&& !HasStoppedSimulation()
+		&& !ShouldSkipUpdate(DeltaTime)
+		&& !Velocity.IsNearlyZero();
+
+	++QueryStats.NumFrames;
+
+	if (!bUseBroadphase)
+	{
+		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		return;
+	}
+
+	// Forces Added Since the Last Frame Apply to This One, They are Cleared Once the Frame is Simulated
+	PendingForceThisUpdate = PendingForce;
+
+	const FVector MoveDelta = ComputeMoveDelta(Velocity, DeltaTime);
+	const float MoveDistance = MoveDelta.Size();
+
+	const FVector Start = UpdatedComponent->GetComponentLocation();
+	const int32 NumSurfaces = OverlapPath(Start, Start + MoveDelta);
+
+	// Same Checks UProjectileMovementComponent::TickComponent Makes Around Its Swept Moves
+	if (NumSurfaces == 0)
+	{
+		ClearPendingForce();
+
+		UMovementComponent::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		if (GetOwner() == nullptr || !CheckStillInWorld())
+		{
+			return;
+		}
+
+		MoveUnobstructed(MoveDelta, DeltaTime);
+		return;
+	}
+
+	// More Surfaces Along the Path, Shorter Substeps, Swept Moves Never Pass Through a Blocking Surface
+	const float SubstepDistance = FMath::Max(MaxSubstepDistance / NumSurfaces, UpdatedComponent->Bounds.SphereRadius);
+	const int32 NumSubsteps = FMath::Clamp(FMath::CeilToInt(MoveDistance / SubstepDistance), 1, 25);
+
+	const bool bPrevForceSubStepping = bForceSubStepping;
+	const float PrevMaxSimulationTimeStep = MaxSimulationTimeStep;
+	const int32 PrevMaxSimulationIterations = MaxSimulationIterations;
+
+	bForceSubStepping = NumSubsteps > 1;
+	MaxSimulationTimeStep = DeltaTime / NumSubsteps;
+	MaxSimulationIterations = FMath::Max(PrevMaxSimulationIterations, NumSubsteps + 1);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	bForceSubStepping = bPrevForceSubStepping;
+	MaxSimulationTimeStep = PrevMaxSimulationTimeStep;
+	MaxSimulationIterations = PrevMaxSimulationIterations;
+}
+
+// Count Swept Moves
+bool UParkourProjectileMovementComponent::MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit, ETeleportType Teleport)
+{
+	QueryStats.NumSweeps += bSweep;
+
+	return Super::MoveUpdatedComponentImpl(Delta, NewRotation, bSweep, OutHit, Teleport);
+}
+
+// Find Anything the Projectile Blocks On or Overlaps Within Its Collision Radius of the Frame's Path
+int32 UParkourProjectileMovementComponent::OverlapPath(const FVector& Start, const FVector& End) const
+{
+	++QueryStats.NumOverlaps;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ParkourProjectileBroadphase), false, GetOwner());
+	if (const AActor* Owner = GetOwner())
+	{
+		QueryParams.AddIgnoredActor(Owner->GetInstigator());
+	}
+
+	// Box Along the Path, Inflated by the Collision Radius, Contains Everything a Sweep Could Graze
+	// A Line Along the Center would Miss Surfaces the Projectile Only Touches with Its Side
+	const FVector Path = End - Start;
+	const float Radius = UpdatedComponent->Bounds.SphereRadius;
+	const FCollisionShape Box = FCollisionShape::MakeBox(FVector(0.5f * Path.Size() + Radius, Radius, Radius));
+
+	TArray<FOverlapResult> Overlaps;
+	GetWorld()->OverlapMultiByObjectType(Overlaps, Start + 0.5f * Path, Path.ToOrientationQuat(), PathObjectTypes, Box, QueryParams);
+	return Overlaps.Num();
+}
+
+// Move Along a Path Known to be Clear, Without Sweeping
+void UParkourProjectileMovementComponent::MoveUnobstructed(const FVector& MoveDelta, float DeltaTime)
+{
+	Velocity = ComputeVelocity(Velocity, DeltaTime);
+
+	const FQuat NewRotation = bRotationFollowsVelocity && !Velocity.IsNearlyZero(0.01f) ? Velocity.ToOrientationQuat() : UpdatedComponent->GetComponentQuat();
+	MoveUpdatedComponent(MoveDelta, NewRotation, false);
+
+	// Falling Below Kill Z or Leaving the World Bounds Destroys the Projectile
+	if (!CheckStillInWorld())
+	{
+		return;
+	}
+
+	UpdateComponentVelocity();
+}
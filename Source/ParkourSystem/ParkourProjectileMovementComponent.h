@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "ParkourProjectileMovementComponent.generated.h"
+
+/**
+ * Counters of queries made by UParkourProjectileMovementComponent, summed over all projectiles.
+ */
+struct FParkourProjectileQueryStats
+{
+	// Frames Simulated
+	int64 NumFrames = 0;
+
+	// Broadphase Overlap Queries
+	int64 NumOverlaps = 0;
+
+	// Swept Moves, At Least One per Simulation Substep
+	int64 NumSweeps = 0;
+};
+
+/**
+ * Projectile movement that checks the volume the projectile sweeps this frame with one overlap query before simulating it.
+ * Clear paths are moved without a sweep. Paths crossing geometry are simulated in substeps
+ * sized by speed and by how many surfaces lie along the path, so thin walls are not skipped at low tick rates.
+ */
+UCLASS(ClassGroup = Movement, meta = (BlueprintSpawnableComponent))
+class PARKOURSYSTEM_API UParkourProjectileMovementComponent : public UProjectileMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UParkourProjectileMovementComponent();
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// Longest Distance Moved in One Substep When the Path Crosses Geometry, Shortened as Surfaces Along the Path Increase
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile Simulation", meta = (ClampMin = "1"))
+	float MaxSubstepDistance;
+
+	// Counters Since the Last Reset, Not Synchronized, Game Thread Only
+	static const FParkourProjectileQueryStats& GetQueryStats() { return QueryStats; }
+
+	static void ResetQueryStats() { QueryStats = FParkourProjectileQueryStats(); }
+
+protected:
+	virtual void InitializeComponent() override;
+
+	// Count Swept Moves
+	virtual bool MoveUpdatedComponentImpl(const FVector& Delta, const FQuat& NewRotation, bool bSweep, FHitResult* OutHit = nullptr, ETeleportType Teleport = ETeleportType::None) override;
+
+	// Find Anything the Projectile Blocks On or Overlaps Within Its Collision Radius of the Frame's Path
+	//! @return Number of Surfaces Along the Path
+	int32 OverlapPath(const FVector& Start, const FVector& End) const;
+
+	// Move Along a Path Known to be Clear, Without Sweeping
+	void MoveUnobstructed(const FVector& MoveDelta, float DeltaTime);
+
+	// Object Types the Projectile Blocks, or Overlaps If It Generates Overlap Events, Gathered from Its Collision Responses
+	FCollisionObjectQueryParams PathObjectTypes;
+
+	static FParkourProjectileQueryStats QueryStats;
+};
@@ -0,0 +1,249 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourReplay.h"
+#include "Async/MappedFileHandle.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+
+namespace ParkourReplay
+{
+	static int16 QuantizeInt16(double Value)
+	{
+		return static_cast<int16>(FMath::Clamp<int64>(FMath::RoundToInt64(Value), MIN_int16, MAX_int16));
+	}
+
+	static uint16 QuantizeHalfHeight(float HalfHeight)
+	{
+		return static_cast<uint16>(FMath::Clamp<int32>(FMath::RoundToInt(HalfHeight * HalfHeightScale), 0, MAX_uint16));
+	}
+
+	static void AppendRecord(TArray<uint8>& Bytes, const void* Record, int32 Size)
+	{
+		Bytes.Append(static_cast<const uint8*>(Record), Size);
+	}
+}
+
+FParkourReplayWriter::~FParkourReplayWriter()
+{
+	Close();
+}
+
+bool FParkourReplayWriter::Open(const FString& Filename, float SampleRate, int32 InKeyframeInterval, double StartTime)
+{
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Filename));
+
+	FileHandle.Reset(PlatformFile.OpenWrite(*Filename));
+	if (!FileHandle)
+	{
+		return false;
+	}
+
+	KeyframeInterval = FMath::Clamp(InKeyframeInterval, 1, static_cast<int32>(MAX_uint16));
+	NumSamples = 0;
+
+	ParkourReplay::FHeader Header = {};
+	Header.Magic = ParkourReplay::Magic;
+	Header.Version = ParkourReplay::Version;
+	Header.KeyframeInterval = static_cast<uint16>(KeyframeInterval);
+	Header.SampleRate = SampleRate;
+	Header.StartTime = StartTime;
+
+	PendingBytes.Reset();
+	ParkourReplay::AppendRecord(PendingBytes, &Header, sizeof(Header));
+
+	return true;
+}
+
+void FParkourReplayWriter::Append(const FParkourReplaySample& Sample)
+{
+	if (!FileHandle)
+	{
+		return;
+	}
+
+	const int16 Velocity[3] = { ParkourReplay::QuantizeInt16(Sample.Velocity.X), ParkourReplay::QuantizeInt16(Sample.Velocity.Y), ParkourReplay::QuantizeInt16(Sample.Velocity.Z) };
+
+	if (NumSamples % KeyframeInterval == 0)
+	{
+		ParkourReplay::FKeyframe Keyframe = {};
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Keyframe.Location[Axis] = static_cast<float>(Sample.Location[Axis]);
+			Keyframe.Velocity[Axis] = Velocity[Axis];
+		}
+		Keyframe.CapsuleHalfHeight = ParkourReplay::QuantizeHalfHeight(Sample.CapsuleHalfHeight);
+		Keyframe.Mode = static_cast<uint8>(Sample.Mode);
+
+		DecodedLocation = FVector(Keyframe.Location[0], Keyframe.Location[1], Keyframe.Location[2]);
+		ParkourReplay::AppendRecord(PendingBytes, &Keyframe, sizeof(Keyframe));
+	}
+	else
+	{
+		ParkourReplay::FDelta Delta = {};
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			// Deltas Too Large are Clamped, Later Deltas Catch up Since They are Taken from the Decoded Location
+			Delta.LocationDelta[Axis] = ParkourReplay::QuantizeInt16((Sample.Location[Axis] - DecodedLocation[Axis]) * ParkourReplay::LocationScale);
+			Delta.Velocity[Axis] = Velocity[Axis];
+			DecodedLocation[Axis] += Delta.LocationDelta[Axis] / ParkourReplay::LocationScale;
+		}
+		Delta.CapsuleHalfHeight = ParkourReplay::QuantizeHalfHeight(Sample.CapsuleHalfHeight);
+		Delta.Mode = static_cast<uint8>(Sample.Mode);
+
+		ParkourReplay::AppendRecord(PendingBytes, &Delta, sizeof(Delta));
+	}
+
+	++NumSamples;
+
+	// Write Whole Blocks
+	if (NumSamples % KeyframeInterval == 0)
+	{
+		Flush();
+	}
+}
+
+void FParkourReplayWriter::Flush()
+{
+	if (FileHandle && PendingBytes.Num() > 0)
+	{
+		FileHandle->Write(PendingBytes.GetData(), PendingBytes.Num());
+		PendingBytes.Reset();
+	}
+}
+
+void FParkourReplayWriter::Close()
+{
+	Flush();
+	FileHandle.Reset();
+}
+
+FParkourReplayReader::~FParkourReplayReader()
+{
+	Close();
+}
+
+bool FParkourReplayReader::Open(const FString& Filename)
+{
+	Close();
+
+	MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!MappedHandle || MappedHandle->GetFileSize() < static_cast<int64>(sizeof(ParkourReplay::FHeader)))
+	{
+		Close();
+		return false;
+	}
+
+	FileSize = MappedHandle->GetFileSize();
+	MappedRegion.Reset(MappedHandle->MapRegion(0, FileSize));
+	if (!MappedRegion)
+	{
+		Close();
+		return false;
+	}
+
+	Data = MappedRegion->GetMappedPtr();
+	FMemory::Memcpy(&Header, Data, sizeof(Header));
+
+	if (Header.Magic != ParkourReplay::Magic || Header.Version != ParkourReplay::Version || Header.KeyframeInterval == 0 || Header.SampleRate <= 0.f)
+	{
+		Close();
+		return false;
+	}
+
+	// Derived from Size, so a Recording Cut Short Still Plays up to Its Last Whole Record
+	const int64 BlockSize = ParkourReplay::GetBlockSize(Header.KeyframeInterval);
+	const int64 RecordBytes = FileSize - sizeof(Header);
+	const int64 NumBlocks = RecordBytes / BlockSize;
+	const int64 TailBytes = RecordBytes % BlockSize;
+	const int64 TailSamples = TailBytes >= static_cast<int64>(sizeof(ParkourReplay::FKeyframe)) ? 1 + (TailBytes - sizeof(ParkourReplay::FKeyframe)) / sizeof(ParkourReplay::FDelta) : 0;
+
+	NumSamples = static_cast<int32>(FMath::Min<int64>(NumBlocks * Header.KeyframeInterval + TailSamples, MAX_int32));
+	return true;
+}
+
+void FParkourReplayReader::Close()
+{
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	Data = nullptr;
+	FileSize = 0;
+	NumSamples = 0;
+}
+
+// Decode a Sample, at Most One Keyframe and KeyframeInterval - 1 Deltas Away
+bool FParkourReplayReader::GetSample(int32 Index, FParkourReplaySample& OutSample) const
+{
+	if (Data == nullptr || Index < 0 || Index >= NumSamples)
+	{
+		return false;
+	}
+
+	const int32 BlockIndex = Index / Header.KeyframeInterval;
+	const int32 NumDeltas = Index % Header.KeyframeInterval;
+	const uint8* Block = Data + sizeof(Header) + BlockIndex * ParkourReplay::GetBlockSize(Header.KeyframeInterval);
+
+	// Records are Copied Out, as the Mapping Gives No Alignment Guarantee Within the File
+	ParkourReplay::FKeyframe Keyframe;
+	FMemory::Memcpy(&Keyframe, Block, sizeof(Keyframe));
+
+	FVector Location(Keyframe.Location[0], Keyframe.Location[1], Keyframe.Location[2]);
+	const int16* Velocity = Keyframe.Velocity;
+	uint16 CapsuleHalfHeight = Keyframe.CapsuleHalfHeight;
+	uint8 Mode = Keyframe.Mode;
+
+	ParkourReplay::FDelta Delta;
+	const uint8* DeltaRecord = Block + sizeof(Keyframe);
+	for (int32 DeltaIndex = 0; DeltaIndex < NumDeltas; ++DeltaIndex, DeltaRecord += sizeof(Delta))
+	{
+		FMemory::Memcpy(&Delta, DeltaRecord, sizeof(Delta));
+		Location.X += Delta.LocationDelta[0] / ParkourReplay::LocationScale;
+		Location.Y += Delta.LocationDelta[1] / ParkourReplay::LocationScale;
+		Location.Z += Delta.LocationDelta[2] / ParkourReplay::LocationScale;
+	}
+
+	if (NumDeltas > 0)
+	{
+		Velocity = Delta.Velocity;
+		CapsuleHalfHeight = Delta.CapsuleHalfHeight;
+		Mode = Delta.Mode;
+	}
+
+	OutSample.Location = Location;
+	OutSample.Velocity = FVector(Velocity[0], Velocity[1], Velocity[2]);
+	OutSample.CapsuleHalfHeight = CapsuleHalfHeight / ParkourReplay::HalfHeightScale;
+	OutSample.Mode = static_cast<EParkourMode>(Mode);
+
+	return true;
+}
+
+// Sample Interpolated at Seconds Since the First Sample
+bool FParkourReplayReader::GetSampleAtTime(float Seconds, FParkourReplaySample& OutSample) const
+{
+	if (NumSamples == 0)
+	{
+		return false;
+	}
+
+	const float SampleTime = FMath::Clamp(Seconds * Header.SampleRate, 0.f, static_cast<float>(NumSamples - 1));
+	const int32 Index = FMath::FloorToInt(SampleTime);
+	const float Alpha = SampleTime - Index;
+
+	FParkourReplaySample Next;
+	if (!GetSample(Index, OutSample) || !GetSample(FMath::Min(Index + 1, NumSamples - 1), Next))
+	{
+		return false;
+	}
+
+	OutSample.Location = FMath::Lerp(OutSample.Location, Next.Location, Alpha);
+	OutSample.Velocity = FMath::Lerp(OutSample.Velocity, Next.Velocity, Alpha);
+	OutSample.CapsuleHalfHeight = FMath::Lerp(OutSample.CapsuleHalfHeight, Next.CapsuleHalfHeight, Alpha);
+
+	// Mode Switches Halfway
+	OutSample.Mode = Alpha < 0.5f ? OutSample.Mode : Next.Mode;
+
+	return true;
+}
@@ -0,0 +1,155 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourMode.h"
+
+class IFileHandle;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Movement of a Character at One Instant
+struct FParkourReplaySample
+{
+	FVector Location;
+
+	FVector Velocity;
+
+	float CapsuleHalfHeight;
+
+	EParkourMode Mode;
+};
+
+/**
+ * Replay file of one character: a header, then blocks of one keyframe followed by KeyframeInterval - 1 deltas.
+ * Every record has a fixed size, so the record of any sample is found by arithmetic rather than by scanning.
+ * Records are stored little-endian, as on every platform the project ships.
+ */
+namespace ParkourReplay
+{
+	static constexpr uint32 Magic = 0x504B5250; // 'PKRP'
+	static constexpr uint16 Version = 1;
+
+	// Location Delta Units per Centimetre
+	static constexpr float LocationScale = 10.f;
+
+	// Capsule Half Height Units per Centimetre
+	static constexpr float HalfHeightScale = 100.f;
+
+	struct FHeader
+	{
+		uint32 Magic;
+		uint16 Version;
+		uint16 KeyframeInterval;
+		float SampleRate;
+		uint32 Reserved;
+
+		// World Time of the First Sample
+		double StartTime;
+	};
+
+	// Full Sample, Starts a Block
+	struct FKeyframe
+	{
+		float Location[3];
+		int16 Velocity[3];
+		uint16 CapsuleHalfHeight;
+		uint8 Mode;
+		uint8 Padding[3];
+	};
+
+	// Sample Relative to the Previous One
+	struct FDelta
+	{
+		int16 LocationDelta[3];
+		int16 Velocity[3];
+		uint16 CapsuleHalfHeight;
+		uint8 Mode;
+		uint8 Padding;
+	};
+
+	static_assert(sizeof(FHeader) == 24, "Replay header layout changed");
+	static_assert(sizeof(FKeyframe) == 24, "Replay keyframe layout changed");
+	static_assert(sizeof(FDelta) == 16, "Replay delta layout changed");
+
+	FORCEINLINE int64 GetBlockSize(int32 KeyframeInterval)
+	{
+		return sizeof(FKeyframe) + static_cast<int64>(KeyframeInterval - 1) * sizeof(FDelta);
+	}
+}
+
+/**
+ * Appends samples of one character to a replay file, encoding against the decoded previous sample so quantization error never accumulates.
+ */
+class PARKOURSYSTEM_API FParkourReplayWriter
+{
+public:
+	~FParkourReplayWriter();
+
+	bool Open(const FString& Filename, float SampleRate, int32 KeyframeInterval, double StartTime);
+
+	void Append(const FParkourReplaySample& Sample);
+
+	// Flush and Close, Called by the Destructor If Still Open
+	void Close();
+
+	int32 GetNumSamples() const { return NumSamples; }
+
+private:
+	void Flush();
+
+	TUniquePtr<IFileHandle> FileHandle;
+
+	// Records Not Written Yet
+	TArray<uint8> PendingBytes;
+
+	// Previous Sample as Playback Will Decode It
+	FVector DecodedLocation = FVector::ZeroVector;
+
+	int32 KeyframeInterval = 0;
+
+	int32 NumSamples = 0;
+};
+
+/**
+ * Memory-maps a replay file and decodes samples in place; no allocation after Open().
+ */
+class PARKOURSYSTEM_API FParkourReplayReader
+{
+public:
+	~FParkourReplayReader();
+
+	bool Open(const FString& Filename);
+
+	void Close();
+
+	// Decode a Sample, at Most One Keyframe and KeyframeInterval - 1 Deltas Away
+	bool GetSample(int32 Index, FParkourReplaySample& OutSample) const;
+
+	// Sample Interpolated at Seconds Since the First Sample
+	bool GetSampleAtTime(float Seconds, FParkourReplaySample& OutSample) const;
+
+	int32 GetNumSamples() const { return NumSamples; }
+
+	float GetSampleRate() const { return Header.SampleRate; }
+
+	double GetStartTime() const { return Header.StartTime; }
+
+	float GetDuration() const { return NumSamples > 0 ? (NumSamples - 1) / Header.SampleRate : 0.f; }
+
+	int64 GetFileSize() const { return FileSize; }
+
+private:
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	const uint8* Data = nullptr;
+
+	int64 FileSize = 0;
+
+	ParkourReplay::FHeader Header = {};
+
+	int32 NumSamples = 0;
+};
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourReplaySubsystem.h"
+#include "ParkourSystemCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<bool> CVarParkourRecordReplays(
+	TEXT("parkour.RecordReplays"),
+	false,
+	TEXT("Record parkour movement of every character into Saved/Replays when a match begins."));
+
+static TAutoConsoleVariable<float> CVarParkourReplaySampleRate(
+	TEXT("parkour.ReplaySampleRate"),
+	30.f,
+	TEXT("Samples per second recorded by parkour.RecordReplays."));
+
+static TAutoConsoleVariable<int32> CVarParkourReplayKeyframeInterval(
+	TEXT("parkour.ReplayKeyframeInterval"),
+	30,
+	TEXT("Samples per keyframe in parkour replays; scrubbing decodes at most this many records."));
+
+bool UParkourReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UParkourReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	bRecording = CVarParkourRecordReplays.GetValueOnGameThread();
+	if (!bRecording)
+	{
+		return;
+	}
+
+	SampleInterval = 1.f / FMath::Max(CVarParkourReplaySampleRate.GetValueOnGameThread(), 1.f);
+	KeyframeInterval = FMath::Max(CVarParkourReplayKeyframeInterval.GetValueOnGameThread(), 1);
+	Accumulator = SampleInterval;
+
+	ReplayDir = FPaths::ProjectSavedDir() / TEXT("Replays") / FString::Printf(TEXT("%s_%s"), *InWorld.GetMapName(), *FDateTime::Now().ToString());
+}
+
+void UParkourReplaySubsystem::Tick(float DeltaTime)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	Accumulator += DeltaTime;
+	while (Accumulator >= SampleInterval)
+	{
+		Accumulator -= SampleInterval;
+		RecordSample();
+	}
+}
+
+// Finish the Character's Replay File
+void UParkourReplaySubsystem::CloseReplay(AParkourSystemCharacter* Character)
+{
+	// A Fixed-Rate Stream Cannot Hold a Gap, so Time Spent in the Pool and the Respawn Teleport Never Enter It
+	Writers.Remove(Character);
+}
+
+// Append One Sample of Every Character, Opening Files for New Ones
+void UParkourReplaySubsystem::RecordSample()
+{
+	UWorld* World = GetWorld();
+
+	// Close Files of Destroyed Characters
+	for (auto It = Writers.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TActorIterator<AParkourSystemCharacter> It(World); It; ++It)
+	{
+		AParkourSystemCharacter* Character = *It;
+
+		// Pooled Characters are Hidden and Frozen, Waiting to Respawn
+		if (Character->IsPooled())
+		{
+			continue;
+		}
+
+		TUniquePtr<FParkourReplayWriter>& Writer = Writers.FindOrAdd(Character);
+		if (!Writer)
+		{
+			Writer = MakeUnique<FParkourReplayWriter>();
+
+			// Pooled Characters Respawn Under the Same Name, Each Life Gets Its Own File
+			FString Filename = ReplayDir / FString::Printf(TEXT("%s.pkreplay"), *Character->GetName());
+			for (int32 Life = 1; IFileManager::Get().FileExists(*Filename); ++Life)
+			{
+				Filename = ReplayDir / FString::Printf(TEXT("%s_%d.pkreplay"), *Character->GetName(), Life);
+			}
+
+			Writer->Open(Filename, 1.f / SampleInterval, KeyframeInterval, World->GetTimeSeconds());
+		}
+
+		FParkourReplaySample Sample;
+		Sample.Location = Character->GetActorLocation();
+		Sample.Velocity = Character->GetCharacterMovement()->Velocity;
+		Sample.CapsuleHalfHeight = Character->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+		Sample.Mode = Character->GetParkourMode();
+
+		Writer->Append(Sample);
+	}
+}
+
+TStatId UParkourReplaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UParkourReplaySubsystem, STATGROUP_Tickables);
+}
+
+void UParkourReplaySubsystem::Deinitialize()
+{
+	Writers.Reset();
+	bRecording = false;
+
+	Super::Deinitialize();
+}
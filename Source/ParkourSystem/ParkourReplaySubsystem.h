@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ParkourReplay.h"
+#include "ParkourReplaySubsystem.generated.h"
+
+class AParkourSystemCharacter;
+
+/**
+ * Records every parkour character of a match at a fixed rate into one replay file each, for killcams and match replays.
+ * Enabled by parkour.RecordReplays when the world begins play.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourReplaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Folder Replay Files of This Match are Written to
+	const FString& GetReplayDir() const { return ReplayDir; }
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// End of FTickableGameObject interface
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+	// Finish the Character's Replay File, Its Next Sample Starts a New One
+	void CloseReplay(AParkourSystemCharacter* Character);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Append One Sample of Every Character, Opening Files for New Ones
+	void RecordSample();
+
+private:
+	TMap<TWeakObjectPtr<AParkourSystemCharacter>, TUniquePtr<FParkourReplayWriter>> Writers;
+
+	FString ReplayDir;
+
+	float SampleInterval = 0.f;
+
+	int32 KeyframeInterval = 0;
+
+	// Time Not Sampled Yet
+	float Accumulator = 0.f;
+
+	bool bRecording = false;
+};
@@ -0,0 +1,207 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourReplicationGraph.h"
+#include "ParkourSystemCharacter.h"
+#include "ParkourSystemProjectile.h"
+#include "ParkourTuning.h"
+#include "ReplicationGraphTypes.h"
+#include "TP_PickUpComponent.h"
+#include "Engine/ChildConnection.h"
+#include "Engine/NetConnection.h"
+
+DECLARE_CYCLE_STAT(TEXT("Parkour Replicate Actors"), STAT_ParkourReplicateActors, STATGROUP_Game);
+
+UParkourReplicationGraph::UParkourReplicationGraph()
+	: SecondsToCrossCell(5.f)
+	, MinCellSize(5000.f)
+	, CullDistance(15000.f)
+	, GridNode(nullptr)
+	, ProjectileGridNode(nullptr)
+	, AlwaysRelevantNode(nullptr)
+	, LastReplicateMs(0.f)
+{
+}
+
+// Grid Cell Size, Derived from the Fastest Speed of the Default Parkour Tuning
+float UParkourReplicationGraph::ComputeCellSize() const
+{
+	// Momentum Budget Caps Speed Carried Through Slide and Jump Chains
+	const UParkourTuning* Tuning = GetDefault<UParkourTuning>();
+	const float MaxSpeed = FMath::Max3(Tuning->SprintSpeed, Tuning->SlideSpeed, Tuning->MomentumSpeedBudget);
+
+	return FMath::Max(MinCellSize, MaxSpeed * SecondsToCrossCell);
+}
+
+void UParkourReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	FClassReplicationInfo CharacterInfo;
+	CharacterInfo.DistancePriorityScale = 1.f;
+	CharacterInfo.StarvationPriorityScale = 1.f;
+	CharacterInfo.ReplicationPeriodFrame = 1;
+	CharacterInfo.SetCullDistanceSquared(FMath::Square(CullDistance));
+	GlobalActorReplicationInfoMap.SetClassInfo(AParkourSystemCharacter::StaticClass(), CharacterInfo);
+
+	// Projectiles are Small and Short Lived, not Worth Sending as Far as Characters
+	FClassReplicationInfo ProjectileInfo = CharacterInfo;
+	ProjectileInfo.SetCullDistanceSquared(FMath::Square(CullDistance * 0.5f));
+	GlobalActorReplicationInfoMap.SetClassInfo(AParkourSystemProjectile::StaticClass(), ProjectileInfo);
+}
+
+void UParkourReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = ComputeCellSize();
+	GridNode->SpatialBias = FVector2D(-UE_OLD_WORLD_MAX, -UE_OLD_WORLD_MAX);
+
+	// Moving Actors in Each Cell are Gathered Less Often the Farther They are from the Viewer
+	GridNode->CreateDynamicNodeOverride = [](UReplicationGraphNode_GridCell* Parent) -> UReplicationGraphNode*
+	{
+		return Parent->CreateChildNode<UReplicationGraphNode_DynamicSpatialFrequency>();
+	};
+	AddGlobalGraphNode(GridNode);
+
+	// Projectiles Cross Cells Fast and Live Briefly, Throttling Them by Distance Would Drop Whole Shots
+	ProjectileGridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	ProjectileGridNode->CellSize = GridNode->CellSize;
+	ProjectileGridNode->SpatialBias = GridNode->SpatialBias;
+	AddGlobalGraphNode(ProjectileGridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UParkourReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(Node, RepGraphConnection);
+	AlwaysRelevantForConnectionNodes.Add(RepGraphConnection->NetConnection, Node);
+}
+
+void UParkourReplicationGraph::RemoveClientConnection(UNetConnection* NetConnection)
+{
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* RemovedNode = nullptr;
+	if (AlwaysRelevantForConnectionNodes.RemoveAndCopyValue(NetConnection, RemovedNode))
+	{
+		// Owner Only Actors of the Connection Wait Again, in Case Their Owner Gets Another One
+		for (auto It = OwnerOnlyActorNodes.CreateIterator(); It; ++It)
+		{
+			if (It.Value() == RemovedNode)
+			{
+				ActorsWithoutNetConnection.Add(It.Key());
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	Super::RemoveClientConnection(NetConnection);
+}
+
+UReplicationGraphNode_AlwaysRelevant_ForConnection* UParkourReplicationGraph::GetAlwaysRelevantNodeForConnection(UNetConnection* Connection) const
+{
+	// Connection Nodes are Only Made for Parent Connections
+	if (Connection != nullptr)
+	{
+		if (UChildConnection* ChildConnection = Connection->GetUChildConnection())
+		{
+			Connection = ChildConnection->Parent;
+		}
+	}
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* const* Node = AlwaysRelevantForConnectionNodes.Find(Connection);
+	return Node != nullptr ? *Node : nullptr;
+}
+
+void UParkourReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+
+	// Weapon Pickups are Few and Wanted Everywhere, Relevancy Checks on Them are Wasted
+	if (Actor->bAlwaysRelevant || Actor->FindComponentByClass<UTP_PickUpComponent>() != nullptr)
+	{
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+	}
+	else if (Actor->bOnlyRelevantToOwner)
+	{
+		ActorsWithoutNetConnection.Add(Actor);
+	}
+	else if (Actor->IsA<AParkourSystemProjectile>())
+	{
+		ProjectileGridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+	}
+	else if (Actor->IsA<AParkourSystemCharacter>())
+	{
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+	}
+	else
+	{
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+	}
+}
+
+void UParkourReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+
+	// Pickup Component may be Gone by Now, so Try the Node Instead of Classifying Again
+	if (AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo, false))
+	{
+		return;
+	}
+
+	if (Actor->bOnlyRelevantToOwner)
+	{
+		ActorsWithoutNetConnection.Remove(Actor);
+
+		UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = nullptr;
+		if (OwnerOnlyActorNodes.RemoveAndCopyValue(Actor, Node))
+		{
+			Node->NotifyRemoveNetworkActor(ActorInfo, false);
+		}
+	}
+	else if (Actor->IsA<AParkourSystemProjectile>())
+	{
+		ProjectileGridNode->RemoveActor_Dynamic(ActorInfo);
+	}
+	else if (Actor->IsA<AParkourSystemCharacter>())
+	{
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+	}
+	else
+	{
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+	}
+}
+
+int32 UParkourReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ParkourReplicateActors);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	// Owner Only Actors Go to Their Owner's Node Once Its Connection Has One, and Keep Waiting Until Then
+	for (int32 Index = ActorsWithoutNetConnection.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Actor = ActorsWithoutNetConnection[Index];
+		if (Actor == nullptr)
+		{
+			ActorsWithoutNetConnection.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		if (UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = GetAlwaysRelevantNodeForConnection(Actor->GetNetConnection()))
+		{
+			Node->NotifyAddNetworkActor(FNewReplicatedActorInfo(Actor));
+			OwnerOnlyActorNodes.Add(Actor, Node);
+			ActorsWithoutNetConnection.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	const int32 Result = Super::ServerReplicateActors(DeltaSeconds);
+
+	LastReplicateMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+	return Result;
+}
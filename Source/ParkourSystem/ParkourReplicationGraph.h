@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "ParkourReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+class UReplicationGraphNode_GridSpatialization2D;
+
+/**
+ * Replication graph for parkour matches, used by the net driver through ReplicationDriverClassName in DefaultEngine.ini.
+ * Characters are gathered from a spatial grid with cells sized from the fastest parkour speed,
+ * and replicate less often the farther they are from the viewer. Projectiles have a grid of their own and are gathered every frame,
+ * so a burst of fire never delays characters sharing its cell's frequency buckets. Weapon pickups are relevant to every connection.
+ */
+UCLASS(Transient, Config = Engine)
+class PARKOURSYSTEM_API UParkourReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	UParkourReplicationGraph();
+
+	virtual void InitGlobalActorClassSettings() override;
+
+	virtual void InitGlobalGraphNodes() override;
+
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+
+	virtual void RemoveClientConnection(UNetConnection* NetConnection) override;
+
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+	// Milliseconds the Last ServerReplicateActors Took
+	float GetLastReplicateMs() const { return LastReplicateMs; }
+
+	// Grid Cell Size, Derived from the Fastest Speed of the Default Parkour Tuning
+	float ComputeCellSize() const;
+
+public:
+	// Seconds a Character at Top Parkour Speed Takes to Cross One Grid Cell
+	UPROPERTY(Config)
+	float SecondsToCrossCell;
+
+	// Cell Size Used When Parkour Speeds are Low
+	UPROPERTY(Config)
+	float MinCellSize;
+
+	// Characters Farther Than This are not Replicated, Projectiles Use Half
+	UPROPERTY(Config)
+	float CullDistance;
+
+protected:
+	// Node Holding Actors Only Relevant to Their Owner's Connection, the Parent's for a Split-Screen Child Connection
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* GetAlwaysRelevantNodeForConnection(UNetConnection* Connection) const;
+
+	UPROPERTY()
+	UReplicationGraphNode_GridSpatialization2D* GridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_GridSpatialization2D* ProjectileGridNode;
+
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode;
+
+	UPROPERTY()
+	TMap<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*> AlwaysRelevantForConnectionNodes;
+
+	// Owner Only Actors Waiting for Their Owner to Have a Connection
+	UPROPERTY()
+	TArray<AActor*> ActorsWithoutNetConnection;
+
+	// Node Each Owner Only Actor was Added to, as Its Net Connection is Often Gone When It is Removed
+	UPROPERTY()
+	TMap<AActor*, UReplicationGraphNode_AlwaysRelevant_ForConnection*> OwnerOnlyActorNodes;
+
+	float LastReplicateMs;
+};
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ParkourRoute.generated.h"
+
+/**
+ * One step of a scripted parkour route, holding the synthetic input fed to a bot.
+ */
+USTRUCT(BlueprintType)
+struct FParkourRouteStep
+{
+	GENERATED_BODY()
+
+	// Seconds the Step Lasts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route, meta = (ClampMin = "0.01"))
+	float Duration = 1.f;
+
+	// Move Input Fed Every Frame (X: Right, Y: Forward)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route)
+	FVector2D Move = FVector2D(0.f, 1.f);
+
+	// Yaw Turned per Second
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route)
+	float YawRate = 0.f;
+
+	// Press Sprint When the Step Starts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route)
+	bool bSprint = false;
+
+	// Press Crouch When the Step Starts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route)
+	bool bCrouch = false;
+
+	// Press Jump When the Step Starts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Route)
+	bool bJump = false;
+};
+
+/**
+ * Parkour route replayed by bots, looping back to the first step when finished.
+ */
+UCLASS(BlueprintType)
+class PARKOURSYSTEM_API UParkourRoute : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Route)
+	TArray<FParkourRouteStep> Steps;
+};
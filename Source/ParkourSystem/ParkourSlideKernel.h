@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourTuning.h"
+
+/**
+ * Per-frame slide math without any component access, so any parkour mode can run it.
+ * Uses squared-length comparisons and at most one normalization per call.
+ */
+struct FParkourSlideKernel
+{
+	// Result of a Single Slide Step
+	struct FResult
+	{
+		// Force to Add to the Movement Component
+		FVector Force;
+
+		// Velocity After Clamping to Max Speed
+		FVector Velocity;
+
+		// If Velocity was Clamped
+		bool bVelocityClamped;
+
+		// If Slide Should Finish
+		bool bShouldEnd;
+	};
+
+	// Downhill Direction Along the Floor, Zero on Flat Floor
+	//! N x (N x Up) is expanded to N * (N.Up) - Up * (N.N), so only one normalization is needed
+	static FORCEINLINE FVector ComputeForceDirection(const FVector& FloorNormal)
+	{
+		const FVector Direction = FloorNormal * FloorNormal.Z - FVector::UpVector * FloorNormal.SizeSquared();
+		const double LengthSquared = Direction.SizeSquared();
+
+		return LengthSquared > UE_SMALL_NUMBER ? Direction * FMath::InvSqrt(LengthSquared) : FVector::ZeroVector;
+	}
+
+	// Compute Force and Clamped Velocity of a Slide Step
+	static FORCEINLINE FResult Step(const FVector& Velocity, const FVector& FloorNormal, float ForceMagnitude, float MaxSpeed, float MaxSpeedSquared, float StopSpeedSquared)
+	{
+		FResult Result;
+
+		const double SpeedSquared = Velocity.SizeSquared();
+		Result.bShouldEnd = SpeedSquared < StopSpeedSquared;
+		Result.Force = ComputeForceDirection(FloorNormal) * ForceMagnitude;
+
+		Result.bVelocityClamped = SpeedSquared > MaxSpeedSquared;
+		Result.Velocity = Result.bVelocityClamped ? Velocity * (MaxSpeed * FMath::InvSqrt(SpeedSquared)) : Velocity;
+
+		return Result;
+	}
+
+	// Compute a Slide Step with Values from Tuning
+	static FORCEINLINE FResult Step(const FVector& Velocity, const FVector& FloorNormal, const UParkourTuning& Tuning)
+	{
+		return Step(Velocity, FloorNormal, Tuning.SlideForce, Tuning.SlideSpeed, Tuning.SlideSpeedSquared, Tuning.SlideStopSpeedSquared);
+	}
+};
@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "ParkourMode.h"
+
+class UPhysicalMaterial;
+
+/**
+ * Hot parkour state of a character, packed into a single cache line.
+ * Flags are bitfields and enums are bytes, so iterating many characters touches as little memory as possible.
+ */
+struct FParkourState
+{
+	FParkourState()
+		: SlideSurfaceMaterial(nullptr)
+		, DefaultWalkSpeed(0.f)
+		, DefaultGroundFriction(0.f)
+		, DefaultBrakingDeceleration(0.f)
+		, StandingCapsuleHalfHeight(0.f)
+		, StandingCameraZOffset(0.f)
+		, SlideCarriedSpeed(0.f)
+		, SlideMaxSpeed(0.f)
+		, SlideSurfaceForce(0.f)
+		, SlideSurfaceMaxSpeed(0.f)
+		, SlideSurfaceMaxSpeedSquared(0.f)
+		, CurrentParkourMode(EParkourMode::EPM_None)
+		, PrevParkourMode(EParkourMode::EPM_None)
+		, bCanSprint(false)
+		, bCanSlide(false)
+		, bIsSprintQueued(false)
+		, bIsSlideQueued(false)
+		, bCanDoubleJump(true)
+	{
+	}
+
+	// Physical Material the Slide Surface was Resolved for, Only Compared and Never Dereferenced
+	const UPhysicalMaterial* SlideSurfaceMaterial;
+
+	/** Defaults Cached at BeginPlay */
+
+	float DefaultWalkSpeed;
+
+	// Ground Friction by Default
+	float DefaultGroundFriction;
+
+	// Braking Deceleration by Default
+	float DefaultBrakingDeceleration;
+
+	float StandingCapsuleHalfHeight;
+
+	float StandingCameraZOffset;
+
+	/** Slide */
+
+	// Speed Carried into Current Slide by a Momentum Chain, 0 Without One
+	float SlideCarriedSpeed;
+
+	// Max Speed of Current Slide, Raised Above SlideSpeed by Carried Momentum
+	float SlideMaxSpeed;
+
+	// Slide Values with the Surface Applied, Updated When the Floor Changes
+	float SlideSurfaceForce;
+
+	float SlideSurfaceMaxSpeed;
+
+	float SlideSurfaceMaxSpeedSquared;
+
+	/** Modes */
+
+	EParkourMode CurrentParkourMode;
+
+	EParkourMode PrevParkourMode;
+
+	/** Flags */
+
+	// If Sprint Update is Running
+	uint8 bCanSprint : 1;
+
+	// If Slide Update is Running
+	uint8 bCanSlide : 1;
+
+	// Whether Sprint is Queued
+	uint8 bIsSprintQueued : 1;
+
+	// If Sliding is Queued
+	uint8 bIsSlideQueued : 1;
+
+	// If Player Can Jump Twice
+	uint8 bCanDoubleJump : 1;
+};
+
+static_assert(sizeof(FParkourState) <= PLATFORM_CACHE_LINE_SIZE, "FParkourState should fit in a single cache line");
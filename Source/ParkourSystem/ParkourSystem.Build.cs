@@ -8,6 +8,9 @@ public class ParkourSystem : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "AIModule", "NavigationSystem", "ReplicationGraph" });
+
+		// Camera Effects, First Person Mesh, Fire Audio and Montages are Compiled Out of Dedicated Servers
+		PublicDefinitions.Add(Target.Type == TargetType.Server ? "PARKOUR_WITH_COSMETICS=0" : "PARKOUR_WITH_COSMETICS=1");
 	}
 }
@@ -1,7 +1,16 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ParkourSystemCharacter.h"
+#include "ParkourCharacterMovementComponent.h"
 #include "ParkourSystemProjectile.h"
+#include "ParkourTuning.h"
+#include "ParkourLatencyTracker.h"
+#include "ParkourReplaySubsystem.h"
+#include "ParkourSlideKernel.h"
+#include "ParkourTrajectorySolver.h"
+#include "ParkourUpdateFrame.h"
+#include "ParkourUpdateSubsystem.h"
+#include "TP_WeaponComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -11,38 +20,29 @@
 #include "InputActionValue.h"
 #include "Engine/LocalPlayer.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
 //////////////////////////////////////////////////////////////////////////
 // AParkourSystemCharacter
 
-AParkourSystemCharacter::AParkourSystemCharacter()
-	: CurrentMovementMode(EMovementMode::MOVE_None)
-	, PreviousMovementMode(EMovementMode::MOVE_None)
-	, CurrentParkourMode(EParkourMode::EPM_None)
-	, PrevParkourMode(EParkourMode::EPM_None)
-	, bCanSprint(false)
-	, bCanSlide(false)
-	, bCanDoubleJump(true)
-	, VerticalJumpForce(450.f)
-	, HorizontalJumpForce(100.f)
-	, SprintSpeed(1000.f)
-	, SprintJumpForce(200.f)
-	, bIsSprintQueued(false)
-	, bIsSlideQueued(false)
-	, CrouchCapsuleHalfHeight(35.f)
-	, CrouchCameraZOffset(60.f)
-	, SlideSpeed(1000.f)
-	, SlideForceMultiplier(100.f)
+AParkourSystemCharacter::AParkourSystemCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UParkourCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
+	, Tuning(nullptr)
 {
 	// Character doesnt have a rifle at start
 	bHasRifle = false;
+
+	bUsesUpdateSubsystem = false;
+	bPooled = false;
 	
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(55.f, 96.0f);
+
+	// Floor Sweeps Return the Physical Material of the Floor's Material, Which Slide Surfaces are Looked up by
+	GetCapsuleComponent()->bReturnMaterialOnMove = true;
 		
 	// Create a CameraComponent	
 	FirstPersonCameraComponent = CreateDefaultSubobject<UCameraComponent>(TEXT("FirstPersonCamera"));
@@ -58,6 +58,24 @@ AParkourSystemCharacter::AParkourSystemCharacter()
 	Mesh1P->CastShadow = false;
 	//Mesh1P->SetRelativeRotation(FRotator(0.9f, -19.19f, 5.2f));
 	Mesh1P->SetRelativeLocation(FVector(-30.f, 0.f, -150.f));
+
+	// Registered in SetupLocalPresentation(), Server and Remote Characters Never See It
+	Mesh1P->bAutoRegister = false;
+
+	// Distant Characters Update Animation Less Often
+	GetMesh()->bEnableUpdateRateOptimizations = true;
+
+#if WITH_EDITORONLY_DATA
+	// Defaults the Old Properties Had, so Only Real Overrides are Migrated
+	VerticalJumpForce_DEPRECATED = 450.f;
+	HorizontalJumpForce_DEPRECATED = 100.f;
+	SprintSpeed_DEPRECATED = 1000.f;
+	SprintJumpForce_DEPRECATED = 200.f;
+	CrouchCapsuleHalfHeight_DEPRECATED = 35.f;
+	CrouchCameraZOffset_DEPRECATED = 60.f;
+	SlideSpeed_DEPRECATED = 1000.f;
+	SlideForceMultiplier_DEPRECATED = 100.f;
+#endif
 }
 
 void AParkourSystemCharacter::BeginPlay()
@@ -65,23 +83,133 @@ void AParkourSystemCharacter::BeginPlay()
 	// Call the base class  
 	Super::BeginPlay();
 
-	// Add Input Mapping Context
-	if (APlayerController* PlayerController = Cast<APlayerController>(Controller))
+	SetupLocalPresentation();
+
+	ParkourState.DefaultWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
+	ParkourState.DefaultGroundFriction = GetCharacterMovement()->GroundFriction;
+	ParkourState.DefaultBrakingDeceleration = GetCharacterMovement()->BrakingDecelerationWalking;
+
+	ParkourState.StandingCapsuleHalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	ParkourState.StandingCameraZOffset = GetFirstPersonCameraComponent()->GetRelativeLocation().Z;
+	AppliedCameraPose = { ParkourState.StandingCameraZOffset, 0.f, 0.f };
+
+	UParkourTuning::OnTuningChanged.AddUObject(this, &AParkourSystemCharacter::OnTuningChanged);
+
+	if (UParkourUpdateSubsystem* UpdateSubsystem = GetWorld()->GetSubsystem<UParkourUpdateSubsystem>())
+	{
+		UpdateSubsystem->Register(this);
+		bUsesUpdateSubsystem = true;
+	}
+}
+
+void AParkourSystemCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UParkourTuning::OnTuningChanged.RemoveAll(this);
+
+	if (bUsesUpdateSubsystem)
+	{
+		if (UParkourUpdateSubsystem* UpdateSubsystem = GetWorld()->GetSubsystem<UParkourUpdateSubsystem>())
+		{
+			UpdateSubsystem->Unregister(this);
+		}
+		bUsesUpdateSubsystem = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AParkourSystemCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	SetupLocalPresentation();
+}
+
+// Register Mesh1P and Add Input Mapping Context While Locally Controlled, Unregister Mesh1P Otherwise
+void AParkourSystemCharacter::SetupLocalPresentation()
+{
+	if (GetWorld() == nullptr)
+	{
+		return;
+	}
+
+	if (!IsLocallyControlled())
+	{
+		// No Longer Seen in First Person, e.g. Repossessed from the Respawn Pool by Another Controller
+		if (Mesh1P->IsRegistered())
+		{
+			Mesh1P->UnregisterComponent();
+			ReattachWeapons();
+		}
+		return;
+	}
+
+#if PARKOUR_WITH_COSMETICS
+	if (!Mesh1P->IsRegistered())
+	{
+		Mesh1P->RegisterComponent();
+		ReattachWeapons();
+	}
+#endif
+
+	// Player Controller May Have Added the Same Context Already
+	if (const APlayerController* PlayerController = Cast<APlayerController>(Controller))
 	{
 		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
 		{
-			Subsystem->AddMappingContext(DefaultMappingContext, 0);
+			if (DefaultMappingContext && !Subsystem->HasMappingContext(DefaultMappingContext))
+			{
+				Subsystem->AddMappingContext(DefaultMappingContext, 0);
+			}
 		}
 	}
+}
+
+// Move Held Weapons onto the Component GetWeaponAttachParent() Now Returns
+void AParkourSystemCharacter::ReattachWeapons()
+{
+	TArray<UTP_WeaponComponent*> Weapons;
+	for (const USceneComponent* Parent : { static_cast<USceneComponent*>(Mesh1P), static_cast<USceneComponent*>(GetMesh()), GetRootComponent() })
+	{
+		for (USceneComponent* Child : Parent->GetAttachChildren())
+		{
+			if (UTP_WeaponComponent* Weapon = Cast<UTP_WeaponComponent>(Child))
+			{
+				Weapons.Add(Weapon);
+			}
+		}
+	}
+
+	for (UTP_WeaponComponent* Weapon : Weapons)
+	{
+		Weapon->AttachToCharacter();
+	}
+}
 
-	DefaultWalkSpeed = GetCharacterMovement()->MaxWalkSpeed;
-	DefaultGroundFriction = GetCharacterMovement()->GroundFriction;
-	DefaultBrakingDeceleration = GetCharacterMovement()->BrakingDecelerationWalking;
+// Mesh1P While It is Registered, Else the Third Person Mesh If It has a Grip, Else the Capsule
+USceneComponent* AParkourSystemCharacter::GetWeaponAttachParent(FName& OutSocketName) const
+{
+	static const FName GripPointName(TEXT("GripPoint"));
+	OutSocketName = GripPointName;
 
-	StandingCapsuleHalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	StandingCameraZOffset = GetFirstPersonCameraComponent()->GetRelativeLocation().Z;
+	if (Mesh1P->IsRegistered())
+	{
+		return Mesh1P;
+	}
 
-	CurrentMovementMode = GetCharacterMovement()->MovementMode;
+	if (GetMesh()->IsRegistered() && GetMesh()->DoesSocketExist(GripPointName))
+	{
+		return GetMesh();
+	}
+
+	OutSocketName = NAME_None;
+	return GetRootComponent();
+}
+
+// Tag a Press for Latency Measurement, Before the Action Runs
+void AParkourSystemCharacter::TagLatencyProbe(EParkourLatencyProbe Probe)
+{
+	FParkourLatencyTracker::Get().Begin(this, Probe);
 }
 
 void AParkourSystemCharacter::Tick(float DeltaTime)
@@ -89,22 +217,118 @@ void AParkourSystemCharacter::Tick(float DeltaTime)
 	// Call the base class
 	Super::Tick(DeltaTime);
 
-	if (bCanSprint)
+	// Updated Together with Other Characters
+	if (bUsesUpdateSubsystem)
+	{
+		return;
+	}
+
+	FParkourUpdateFrame Frame;
+	GatherParkourUpdate(Frame);
+	Frame.Compute(DeltaTime);
+	ApplyParkourUpdate(Frame, DeltaTime);
+}
+
+// Read Everything the Per-Frame Update Needs
+void AParkourSystemCharacter::GatherParkourUpdate(FParkourUpdateFrame& Frame)
+{
+	const UParkourTuning& ParkourTuning = GetTuning();
+	const EParkourMode Mode = ParkourState.CurrentParkourMode;
+
+	Frame.bEndSprint = ParkourState.bCanSprint && Mode == EParkourMode::EPM_Sprint && !ForwardInput();
+	Frame.bSliding = ParkourState.bCanSlide && Mode == EParkourMode::EPM_Slide;
+
+	if (Frame.bSliding)
 	{
-		SprintUpdate();
+		const UCharacterMovementComponent* const MovementComponent = GetCharacterMovement();
+		const FHitResult& FloorHit = MovementComponent->CurrentFloor.HitResult;
+
+		// A Single Component Such as a Landscape May Have Several Surfaces
+		const UPhysicalMaterial* FloorPhysicalMaterial = GetFloorPhysicalMaterial();
+		if (FloorPhysicalMaterial != ParkourState.SlideSurfaceMaterial)
+		{
+			ResolveSlideSurface(FloorPhysicalMaterial);
+		}
+
+		Frame.Velocity = MovementComponent->Velocity;
+		Frame.FloorNormal = FloorHit.Normal;
+		Frame.SlideForce = ParkourState.SlideSurfaceForce;
+		Frame.SlideMaxSpeed = ParkourState.SlideSurfaceMaxSpeed;
+		Frame.SlideMaxSpeedSquared = ParkourState.SlideSurfaceMaxSpeedSquared;
+		Frame.SlideStopSpeedSquared = ParkourTuning.SlideStopSpeedSquared;
 	}
 
-	if (bCanSlide)
+	const bool bCrouched = Mode == EParkourMode::EPM_Crouch || Mode == EParkourMode::EPM_Slide;
+	Frame.CapsuleHalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	Frame.TargetCapsuleHalfHeight = bCrouched ? ParkourTuning.CrouchCapsuleHalfHeight : ParkourState.StandingCapsuleHalfHeight;
+	Frame.CrouchInterpSpeed = ParkourTuning.CrouchInterpSpeed;
+}
+
+// Write Results of the Per-Frame Update Back
+void AParkourSystemCharacter::ApplyParkourUpdate(const FParkourUpdateFrame& Frame, float DeltaSeconds)
+{
+	if (Frame.bEndSprint)
 	{
-		SlideUpdate();
+		SprintEnd();
 	}
-	
-	CrouchUpdate();
+
+	if (Frame.bSliding)
+	{
+		if (Frame.Slide.bShouldEnd)
+		{
+			SlideEnd();
+			EndMomentumChain();
+		}
+		else
+		{
+			UCharacterMovementComponent* const MovementComponent = GetCharacterMovement();
+			MovementComponent->AddForce(Frame.Slide.Force);
+			if (Frame.Slide.bVelocityClamped)
+			{
+				MovementComponent->Velocity = Frame.Slide.Velocity;
+			}
+		}
+	}
+
+	if (Frame.NewCapsuleHalfHeight != Frame.CapsuleHalfHeight)
+	{
+		GetCapsuleComponent()->SetCapsuleHalfHeight(Frame.NewCapsuleHalfHeight);
+	}
+
+	PublishAnimState(Frame);
+
+#if PARKOUR_WITH_COSMETICS
+	// Camera is Only Seen by the Local Player, Server and Simulated Proxies Skip It
+	if (IsLocallyControlled())
+	{
+		CameraUpdate(DeltaSeconds);
+	}
+#endif
+}
+
+// Refresh AnimState from This Frame's Update
+void AParkourSystemCharacter::PublishAnimState(const FParkourUpdateFrame& Frame)
+{
+	const UCharacterMovementComponent* const MovementComponent = GetCharacterMovement();
+	const float CrouchDepth = ParkourState.StandingCapsuleHalfHeight - GetTuning().CrouchCapsuleHalfHeight;
+
+	AnimState.Mode = ParkourState.CurrentParkourMode;
+	AnimState.Speed = MovementComponent->Velocity.Size2D();
+	AnimState.CrouchAlpha = CrouchDepth > UE_KINDA_SMALL_NUMBER ? FMath::Clamp((ParkourState.StandingCapsuleHalfHeight - Frame.NewCapsuleHalfHeight) / CrouchDepth, 0.f, 1.f) : 0.f;
+	AnimState.bIsFalling = MovementComponent->IsFalling();
+	AnimState.bHasRifle = bHasRifle;
 }
 
 void AParkourSystemCharacter::Landed(const FHitResult& Hit)
 {
 	Super::Landed(Hit);
+
+#if PARKOUR_WITH_COSMETICS
+	if (IsLocallyControlled())
+	{
+		CameraEffects.NotifyLanded();
+	}
+#endif
 }
 
 // Jump(Including Double Jumping)
@@ -115,24 +339,39 @@ void AParkourSystemCharacter::Jump()
 		return;
 	}
 
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Shortly After Walking Off a Ledge, Jump as If Still on the Ground
+	const bool bCoyoteJump = GetCharacterMovement()->IsFalling() && InputBuffer.ConsumeCoyoteJump(Now, GetTuning().CoyoteTime);
+	const bool bJumpFromGround = !GetCharacterMovement()->IsFalling() || bCoyoteJump;
+
 	// Jump Events
+	SlideJump();
 	CrouchJump();
 	SprintJump();
 
 	Super::Jump();
 
-	/* if (PrevParkourMode == EParkourMode::EPM_Sprint || bIsSprintQueued)
+	if (bCoyoteJump)
 	{
-		const FVector SprintJumpThrust = FVector(SprintJumpForce * GetVelocity().X, SprintJumpForce * GetVelocity().Y, 0.f);
-		LaunchCharacter(SprintJumpThrust, false, false);
-	} */
+		// Movement Refuses a First Jump While Falling, so Launch the Same Velocity It Would Give
+		LaunchCharacter(FParkourTrajectorySolver::GroundJumpVelocity(GetVelocity(), GetActorForwardVector(), GetCharacterMovement()->JumpZVelocity, 0.f), true, true);
+	}
 
-	if (bCanDoubleJump && GetCharacterMovement()->IsFalling())
+	if (bJumpFromGround)
+	{
+		MomentumJumpThrust();
+	}
+	else if (ParkourState.bCanDoubleJump)
 	{
-		const FVector JumpVelocity = { GetActorForwardVector().X * HorizontalJumpForce, GetActorForwardVector().Y * HorizontalJumpForce, VerticalJumpForce};
-		LaunchCharacter(JumpVelocity, false, true);
+		LaunchCharacter(FParkourTrajectorySolver::DoubleJumpVelocity(GetVelocity(), GetActorForwardVector(), GetTuning()), true, true);
 
-		bCanDoubleJump = false;
+		ParkourState.bCanDoubleJump = false;
+	}
+	else
+	{
+		// No Jump Left in the Air, Jump on Landing If It Comes Soon Enough
+		InputBuffer.Push(EParkourInputAction::EPIA_Jump, Now);
 	}
 }
 
@@ -147,10 +386,10 @@ void AParkourSystemCharacter::SprintStart()
 	{
 		if (SetParkourMode(EParkourMode::EPM_Sprint))
 		{
-			GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
+			GetCharacterMovement()->MaxWalkSpeed = GetTuning().SprintSpeed;
 			EnableSprint();
-			bIsSprintQueued = false;
-			bIsSlideQueued = false;
+			ParkourState.bIsSprintQueued = false;
+			ParkourState.bIsSlideQueued = false;
 		}
 	}
 }
@@ -158,11 +397,11 @@ void AParkourSystemCharacter::SprintStart()
 // Called When Player Stops Sprinting
 void AParkourSystemCharacter::SprintEnd()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Sprint && SetParkourMode(EParkourMode::EPM_None))
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Sprint && SetParkourMode(EParkourMode::EPM_None))
 	{
 		DisableSprint();
 
-		GetWorldTimerManager().SetTimer(SprintTimerHandle, this, &AParkourSystemCharacter::EnableSprint, 0.1f);
+		Cooldowns.Start(EParkourCooldown::EPC_Sprint, GetWorld()->GetTimeSeconds(), GetTuning().SprintCooldown);
 	}
 }
 
@@ -174,109 +413,107 @@ bool AParkourSystemCharacter::CanSprint() const
 		return false;
 	}
 
-	return CurrentParkourMode == EParkourMode::EPM_None && GetCharacterMovement()->IsWalking();
-}
-
-// Called Every Frame While Sprinting
-void AParkourSystemCharacter::SprintUpdate()
-{
-	if (CurrentParkourMode == EParkourMode::EPM_Sprint && !ForwardInput())
-	{
-		SprintEnd();
-	}
+	// Queued Sprint Resumes Regardless of Cooldown
+	const bool bCooldownFactors = ParkourState.bIsSprintQueued || Cooldowns.IsReady(EParkourCooldown::EPC_Sprint, GetWorld()->GetTimeSeconds());
+	return ParkourState.CurrentParkourMode == EParkourMode::EPM_None && GetCharacterMovement()->IsWalking() && bCooldownFactors;
 }
 
 // Fired When Sprint Key was Pressed
 void AParkourSystemCharacter::Sprint()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Sprint)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Sprint)
 	{
 		SprintEnd();
 	}
-	else if (CurrentParkourMode == EParkourMode::EPM_None || CurrentParkourMode == EParkourMode::EPM_Crouch)
+	else if (ParkourState.CurrentParkourMode == EParkourMode::EPM_None || ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch)
 	{
 		SprintStart();
+
+		// Pressed in the Air, Sprint on Landing If It Comes Soon Enough
+		if (ParkourState.CurrentParkourMode != EParkourMode::EPM_Sprint && GetCharacterMovement()->IsFalling())
+		{
+			InputBuffer.Push(EParkourInputAction::EPIA_Sprint, GetWorld()->GetTimeSeconds());
+		}
 	}
 }
 
 // Process When Player Jumps or Falls While Sprinting
 void AParkourSystemCharacter::SprintJump()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Sprint)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Sprint)
 	{
+		AddMomentumLink(GetTuning().SprintJumpForce);
+
 		SprintEnd();
-		bIsSprintQueued = true;
+		ParkourState.bIsSprintQueued = true;
 	}
 }
 
 // Called When Player Starts Crouching
 void AParkourSystemCharacter::CrouchStart()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_None)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_None)
 	{
 		SetParkourMode(EParkourMode::EPM_Crouch);
 
 		GetCharacterMovement()->MaxWalkSpeed = GetCharacterMovement()->MaxWalkSpeedCrouched;
-		bIsSprintQueued = false;
-		bIsSlideQueued = false;
+		ParkourState.bIsSprintQueued = false;
+		ParkourState.bIsSlideQueued = false;
 	}
 }
 
 // Called When Player Finishes Crouching
 void AParkourSystemCharacter::CrouchEnd()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Crouch && CanStand())
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch && CanStand())
 	{
 		SetParkourMode(EParkourMode::EPM_None);
 
-		GetCharacterMovement()->MaxWalkSpeed = DefaultWalkSpeed;
-		bIsSprintQueued = false;
-		bIsSlideQueued = false;
+		GetCharacterMovement()->MaxWalkSpeed = ParkourState.DefaultWalkSpeed;
+		ParkourState.bIsSprintQueued = false;
+		ParkourState.bIsSlideQueued = false;
 	}
 }
 
-// Called Every Frame with Regard to Crouching
-void AParkourSystemCharacter::CrouchUpdate()
+// Called Every Frame for Locally Controlled Characters
+void AParkourSystemCharacter::CameraUpdate(float DeltaSeconds)
 {
-	float CurrentHalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
-	FVector CurrentOffset = GetFirstPersonCameraComponent()->GetRelativeLocation();
+	const bool bCrouched = ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch || ParkourState.CurrentParkourMode == EParkourMode::EPM_Slide;
+	const float TargetZOffset = bCrouched ? GetTuning().CrouchCameraZOffset : ParkourState.StandingCameraZOffset;
 
-	if (CurrentParkourMode == EParkourMode::EPM_Crouch || CurrentParkourMode == EParkourMode::EPM_Slide)
-	{
-		CurrentHalfHeight = FMath::FInterpTo(
-			CurrentHalfHeight, 
-			CrouchCapsuleHalfHeight, 
-			UGameplayStatics::GetWorldDeltaSeconds(this), 
-			10.f);
+	const FParkourCameraPose Pose = CameraEffects.Evaluate(ParkourState.CurrentParkourMode, TargetZOffset, DeltaSeconds, GetTuning());
 
-		CurrentOffset.Z = FMath::FInterpTo(
-			CurrentOffset.Z,
-			CrouchCameraZOffset,
-			UGameplayStatics::GetWorldDeltaSeconds(this),
-			10.f);
-	}
-	else
+	const bool bHeightChanged = !Pose.HeightEquals(AppliedCameraPose);
+	const bool bOffsetChanged = !Pose.OffsetEquals(AppliedCameraPose);
+
+	// Effects Settle Between Actions, Nothing is Written Then
+	if (!bHeightChanged && !bOffsetChanged)
 	{
-		CurrentHalfHeight = FMath::FInterpTo(
-			CurrentHalfHeight,
-			StandingCapsuleHalfHeight,
-			UGameplayStatics::GetWorldDeltaSeconds(this),
-			10.f);
+		return;
+	}
 
-		CurrentOffset.Z = FMath::FInterpTo(
-			CurrentOffset.Z,
-			StandingCameraZOffset,
-			UGameplayStatics::GetWorldDeltaSeconds(this),
-			10.f);
+	AppliedCameraPose = Pose;
+	UCameraComponent* const Camera = GetFirstPersonCameraComponent();
+
+	// Only Transform Write of the Frame
+	if (bHeightChanged)
+	{
+		FVector Location = Camera->GetRelativeLocation();
+		Location.Z = Pose.ZOffset;
+		Camera->SetRelativeLocation(Location);
 	}
 
-	GetCapsuleComponent()->SetCapsuleHalfHeight(CurrentHalfHeight);
-	GetFirstPersonCameraComponent()->SetRelativeLocation(CurrentOffset);
+	// Roll and FOV Go Through the Additive Offset, as the Camera Follows Control Rotation, Replaced as a Whole
+	if (bOffsetChanged)
+	{
+		Camera->ClearAdditiveOffset();
+		Camera->AddAdditiveOffset(FTransform(FRotator(0.f, 0.f, Pose.Roll)), Pose.FOVOffset);
+	}
 }
 
 void AParkourSystemCharacter::CrouchJump()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Crouch)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch)
 	{
 		CrouchEnd();
 	}
@@ -285,7 +522,7 @@ void AParkourSystemCharacter::CrouchJump()
 bool AParkourSystemCharacter::CanStand() const
 {
 	const FVector TraceStart = GetActorLocation() - FVector(0.f, 0.f, GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
-	const FVector TraceEnd = TraceStart + FVector(0.f, 0.f, 2.f * StandingCapsuleHalfHeight);
+	const FVector TraceEnd = TraceStart + FVector(0.f, 0.f, 2.f * ParkourState.StandingCapsuleHalfHeight);
 
 	FHitResult HitResult;
 	return !GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECollisionChannel::ECC_Visibility);
@@ -304,7 +541,8 @@ void AParkourSystemCharacter::CrouchSlideKeyPressed()
 		}
 		else
 		{
-			bIsSlideQueued = true;
+			ParkourState.bIsSlideQueued = true;
+			InputBuffer.Push(EParkourInputAction::EPIA_Crouch, GetWorld()->GetTimeSeconds());
 		}
 	}
 	else
@@ -316,11 +554,11 @@ void AParkourSystemCharacter::CrouchSlideKeyPressed()
 // Toggle Crouch and Standing
 void AParkourSystemCharacter::CrouchToggle()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_None)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_None)
 	{
 		CrouchStart();
 	}
-	else if (CurrentParkourMode == EParkourMode::EPM_Crouch)
+	else if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch)
 	{
 		CrouchEnd();
 	}
@@ -338,69 +576,115 @@ void AParkourSystemCharacter::SlideStart()
 		// Slide Mechanism
 		GetCharacterMovement()->GroundFriction = 0.f;
 		GetCharacterMovement()->MaxWalkSpeed = 0.f;
-		GetCharacterMovement()->BrakingDecelerationWalking = 1000.f;
 
 		const FVector FloorNormal = GetCharacterMovement()->CurrentFloor.HitResult.Normal;
 		const FVector SlideDirection = FVector::CrossProduct(GetActorRightVector(), FloorNormal).GetSafeNormal();
 
-		GetCharacterMovement()->AddImpulse(SlideSpeed * SlideDirection, true);
+		GetCharacterMovement()->AddImpulse(GetTuning().SlideSpeed * SlideDirection, true);
+
+		// Landing into a Slide Keeps the Chain Going
+		ParkourState.SlideCarriedSpeed = Momentum.IsChainActive() ? AddMomentumLink(0.f) : 0.f;
+		ParkourState.SlideMaxSpeed = FMath::Max(GetTuning().SlideSpeed, ParkourState.SlideCarriedSpeed);
+
+		ResolveSlideSurface(GetFloorPhysicalMaterial());
 
 		EnableSlide();
-		bIsSprintQueued = false;
-		bIsSlideQueued = false;
+		ParkourState.bIsSprintQueued = false;
+		ParkourState.bIsSlideQueued = false;
 	}
 }
 
 // Finish Sliding
 void AParkourSystemCharacter::SlideEnd()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Slide)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Slide)
 	{
 		if (SetParkourMode(EParkourMode::EPM_Crouch))
 		{
 			DisableSlide();
+
+			Cooldowns.Start(EParkourCooldown::EPC_Slide, GetWorld()->GetTimeSeconds(), GetTuning().SlideCooldown);
 		}
 	}
 }
 
-// Called Every Frame, with Regard to Sliding
-void AParkourSystemCharacter::SlideUpdate()
+// Physical Material of the Current Floor
+const UPhysicalMaterial* AParkourSystemCharacter::GetFloorPhysicalMaterial() const
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Slide)
+	const FHitResult& FloorHit = GetCharacterMovement()->CurrentFloor.HitResult;
+	if (const UPhysicalMaterial* PhysicalMaterial = FloorHit.PhysMaterial.Get())
 	{
-		if (GetCharacterMovement()->Velocity.Length() < 35.f)
-		{
-			SlideEnd();
-		}
+		return PhysicalMaterial;
+	}
 
-		const FVector FloorNormal = GetCharacterMovement()->CurrentFloor.HitResult.Normal;
-		const FVector ForceDirection = FVector::CrossProduct(FloorNormal, FVector::CrossProduct(FloorNormal, FVector::UpVector)).GetSafeNormal();
+	// Floor Found Without a Sweep Returning Its Material
+	const UPrimitiveComponent* FloorComponent = FloorHit.GetComponent();
+	if (FloorComponent != nullptr && FloorComponent->GetBodyInstance() != nullptr)
+	{
+		return FloorComponent->GetBodyInstance()->GetSimplePhysicalMaterial();
+	}
 
-		UE_LOG(LogTemp, Warning, TEXT("%s"), *ForceDirection.ToString());
+	return nullptr;
+}
 
-		GetCharacterMovement()->AddForce(ForceDirection * SlideSpeed * SlideForceMultiplier);
-		if (GetCharacterMovement()->Velocity.Length() > SlideSpeed)
-		{
-			GetCharacterMovement()->Velocity = SlideSpeed * GetCharacterMovement()->Velocity.GetSafeNormal();
-		}
-	}
+// Look up How the Floor Affects Sliding
+void AParkourSystemCharacter::ResolveSlideSurface(const UPhysicalMaterial* PhysicalMaterial)
+{
+	ParkourState.SlideSurfaceMaterial = PhysicalMaterial;
+
+	const UParkourTuning& ParkourTuning = GetTuning();
+	const FParkourSlideSurface& Surface = ParkourTuning.FindSlideSurface(PhysicalMaterial);
+
+	ParkourState.SlideSurfaceForce = ParkourTuning.SlideForce * Surface.AccelerationScale;
+	ParkourState.SlideSurfaceMaxSpeed = ParkourState.SlideMaxSpeed * Surface.MaxSpeedScale;
+	ParkourState.SlideSurfaceMaxSpeedSquared = FMath::Square(ParkourState.SlideSurfaceMaxSpeed);
+
+	GetCharacterMovement()->BrakingDecelerationWalking = ParkourTuning.SlideBrakingDeceleration * Surface.DecelerationScale;
 }
 
 // Check If Player Can Slide
 bool AParkourSystemCharacter::CanSlide()
 {
-	const bool bSprintFactors = CurrentParkourMode == EParkourMode::EPM_Sprint || bIsSprintQueued;
-	return ForwardInput() && bSprintFactors;
+	const bool bSprintFactors = ParkourState.CurrentParkourMode == EParkourMode::EPM_Sprint || ParkourState.bIsSprintQueued;
+	return ForwardInput() && bSprintFactors && Cooldowns.IsReady(EParkourCooldown::EPC_Slide, GetWorld()->GetTimeSeconds());
 }
 
 void AParkourSystemCharacter::SlideJump()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_Slide)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Slide)
 	{
+		AddMomentumLink(0.f);
+
 		SlideEnd();
 	}
 }
 
+// Add a Link to the Momentum Chain
+float AParkourSystemCharacter::AddMomentumLink(float BonusSpeed)
+{
+	const UParkourTuning& ParkourTuning = GetTuning();
+	return Momentum.AddLink(GetVelocity().Size2D(), BonusSpeed, ParkourTuning.MomentumCarryRatio, ParkourTuning.MomentumSpeedBudget, GetWorld()->GetTimeSeconds());
+}
+
+// Finish the Momentum Chain
+void AParkourSystemCharacter::EndMomentumChain()
+{
+	Momentum.EndChain(GetWorld()->GetTimeSeconds());
+}
+
+// Launch with the Carried Speed Without Losing Jump Height
+void AParkourSystemCharacter::MomentumJumpThrust()
+{
+	const float CarriedSpeed = Momentum.GetCarriedSpeed();
+	if (!FParkourTrajectorySolver::ShouldThrust(GetVelocity(), CarriedSpeed))
+	{
+		return;
+	}
+
+	// Pending Launch Replaces the Velocity the Jump Sets, so It Carries the Jump's Z Velocity too
+	LaunchCharacter(FParkourTrajectorySolver::GroundJumpVelocity(GetVelocity(), GetActorForwardVector(), GetCharacterMovement()->JumpZVelocity, CarriedSpeed), true, true);
+}
+
 // Compute the Influence of Slope
 FVector AParkourSystemCharacter::CalculateFloorInfluenceVector(const FVector& FloorNormal) const
 {
@@ -422,6 +706,13 @@ void AParkourSystemCharacter::SetupPlayerInputComponent(UInputComponent* PlayerI
 	// Set up action bindings
 	if (UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(PlayerInputComponent))
 	{
+		// Latency Tags, Bound First so that They See the State Before Each Action
+		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &AParkourSystemCharacter::TagLatencyProbe, EParkourLatencyProbe::EPLP_Jump);
+		EnhancedInputComponent->BindAction(SprintAction, ETriggerEvent::Started, this, &AParkourSystemCharacter::TagLatencyProbe, EParkourLatencyProbe::EPLP_Sprint);
+		EnhancedInputComponent->BindAction(CrouchAction, ETriggerEvent::Started, this, &AParkourSystemCharacter::TagLatencyProbe, EParkourLatencyProbe::EPLP_Crouch);
+		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Started, this, &AParkourSystemCharacter::TagLatencyProbe, EParkourLatencyProbe::EPLP_Move);
+		EnhancedInputComponent->BindAction(LookAction, ETriggerEvent::Started, this, &AParkourSystemCharacter::TagLatencyProbe, EParkourLatencyProbe::EPLP_Look);
+
 		// Jumping
 		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Started, this, &AParkourSystemCharacter::Jump);
 		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &ACharacter::StopJumping);
@@ -450,7 +741,7 @@ void AParkourSystemCharacter::Move(const FInputActionValue& Value)
 	// input is a Vector2D
 	FVector2D MovementVector = Value.Get<FVector2D>();
 
-	if (Controller != nullptr && CurrentParkourMode != EParkourMode::EPM_Slide)
+	if (Controller != nullptr && ParkourState.CurrentParkourMode != EParkourMode::EPM_Slide)
 	{
 		// add movement 
 		AddMovementInput(GetActorForwardVector(), MovementVector.Y);
@@ -463,12 +754,20 @@ void AParkourSystemCharacter::Look(const FInputActionValue& Value)
 	// input is a Vector2D
 	FVector2D LookAxisVector = Value.Get<FVector2D>();
 
-	if (Controller != nullptr)
+	if (Controller != nullptr && Controller->IsLocalPlayerController())
 	{
 		// add yaw and pitch input to controller
 		AddControllerYawInput(LookAxisVector.X);
 		AddControllerPitchInput(LookAxisVector.Y);
 	}
+	else if (Controller != nullptr)
+	{
+		// Only Player Controllers Accumulate Look Input, so Bots Turn the Control Rotation Directly
+		FRotator NewControlRotation = Controller->GetControlRotation();
+		NewControlRotation.Yaw += LookAxisVector.X;
+		NewControlRotation.Pitch = FMath::ClampAngle(NewControlRotation.Pitch + LookAxisVector.Y, -89.f, 89.f);
+		Controller->SetControlRotation(NewControlRotation);
+	}
 }
 
 // Called When MovementMode is Changed
@@ -481,11 +780,17 @@ void AParkourSystemCharacter::OnMovementModeChanged(EMovementMode InPrevMovement
 		return;
 	}
 
-	PreviousMovementMode = InPrevMovementMode;
-	CurrentMovementMode = GetCharacterMovement()->MovementMode;
+	const EMovementMode PreviousMovementMode = InPrevMovementMode;
+	const EMovementMode CurrentMovementMode = GetCharacterMovement()->MovementMode;
 
 	if (PreviousMovementMode == EMovementMode::MOVE_Walking && CurrentMovementMode == EMovementMode::MOVE_Falling)
 	{
+		// Neither Jumped Nor Launched, so Coyote Time Starts
+		if (!bPressedJump && GetCharacterMovement()->PendingLaunchVelocity.IsZero())
+		{
+			InputBuffer.NotifyWalkedOff(GetWorld()->GetTimeSeconds());
+		}
+
 		SprintJump();
 		// End Events
 		SprintEnd();
@@ -494,50 +799,175 @@ void AParkourSystemCharacter::OnMovementModeChanged(EMovementMode InPrevMovement
 	}
 	else if (PreviousMovementMode == EMovementMode::MOVE_Falling && CurrentMovementMode == EMovementMode::MOVE_Walking)
 	{
-		bCanDoubleJump = true;
+		ParkourState.bCanDoubleJump = true;
+		InputBuffer.NotifyLanded();
+
+		// Presses Made in the Air Only Act If Landing Came Soon Enough
+		const double Now = GetWorld()->GetTimeSeconds();
+		const float BufferWindow = GetTuning().InputBufferWindow;
+
+		if (ParkourState.bIsSlideQueued && !InputBuffer.Consume(EParkourInputAction::EPIA_Crouch, Now, BufferWindow))
+		{
+			ParkourState.bIsSlideQueued = false;
+		}
+
+		if (InputBuffer.Consume(EParkourInputAction::EPIA_Sprint, Now, BufferWindow))
+		{
+			ParkourState.bIsSprintQueued = true;
+		}
+
+		const bool bBufferedJump = InputBuffer.Consume(EParkourInputAction::EPIA_Jump, Now, BufferWindow);
+
+		// Chain Continues Only When Landing into a Slide
+		if (!ParkourState.bIsSlideQueued)
+		{
+			EndMomentumChain();
+		}
+
 		CheckQueues();
+
+		if (bBufferedJump)
+		{
+			Jump();
+		}
 	}
 }
 
 // Set ParkourMode
 bool AParkourSystemCharacter::SetParkourMode(EParkourMode InNewParkourMode)
 {
-	if (InNewParkourMode == CurrentParkourMode)
+	if (InNewParkourMode == ParkourState.CurrentParkourMode)
 	{
 		return false;
 	}
 	else
 	{
-		PrevParkourMode = CurrentParkourMode;
-		CurrentParkourMode = InNewParkourMode;
+		ParkourState.PrevParkourMode = ParkourState.CurrentParkourMode;
+		ParkourState.CurrentParkourMode = InNewParkourMode;
 
 		ResetMovement();
 		return true;
 	}
 }
 
+// Hide and Stop Updating While Pooled
+void AParkourSystemCharacter::DeactivateForPool()
+{
+	// A Fresh Spawn Holds No Weapon
+	TArray<AActor*> AttachedActors;
+	GetAttachedActors(AttachedActors);
+	for (AActor* AttachedActor : AttachedActors)
+	{
+		AttachedActor->Destroy();
+	}
+	SetHasRifle(false);
+
+	if (bUsesUpdateSubsystem)
+	{
+		if (UParkourUpdateSubsystem* UpdateSubsystem = GetWorld()->GetSubsystem<UParkourUpdateSubsystem>())
+		{
+			UpdateSubsystem->Unregister(this);
+		}
+	}
+
+	if (UParkourReplaySubsystem* ReplaySubsystem = GetWorld()->GetSubsystem<UParkourReplaySubsystem>())
+	{
+		ReplaySubsystem->CloseReplay(this);
+	}
+
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+	SetActorTickEnabled(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+
+	// Nothing Changes While Pooled, so Clients are not Sent Anything
+	SetNetDormancy(DORM_DormantAll);
+
+	bPooled = true;
+}
+
+// Reset Parkour State to That of a Fresh Spawn
+void AParkourSystemCharacter::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	// Everything but the Defaults Cached at BeginPlay Starts Over
+	const FParkourState CachedState = ParkourState;
+	ParkourState = FParkourState();
+	ParkourState.DefaultWalkSpeed = CachedState.DefaultWalkSpeed;
+	ParkourState.DefaultGroundFriction = CachedState.DefaultGroundFriction;
+	ParkourState.DefaultBrakingDeceleration = CachedState.DefaultBrakingDeceleration;
+	ParkourState.StandingCapsuleHalfHeight = CachedState.StandingCapsuleHalfHeight;
+	ParkourState.StandingCameraZOffset = CachedState.StandingCameraZOffset;
+
+	Cooldowns.ClearAll();
+	InputBuffer = FParkourInputBuffer();
+	Momentum = FParkourMomentum();
+	AnimState = FParkourAnimState();
+
+	UCharacterMovementComponent* const MovementComponent = GetCharacterMovement();
+	MovementComponent->MaxWalkSpeed = ParkourState.DefaultWalkSpeed;
+	MovementComponent->GroundFriction = ParkourState.DefaultGroundFriction;
+	MovementComponent->BrakingDecelerationWalking = ParkourState.DefaultBrakingDeceleration;
+	MovementComponent->SetPlaneConstraintEnabled(false);
+	GetCapsuleComponent()->SetCapsuleHalfHeight(ParkourState.StandingCapsuleHalfHeight);
+
+#if PARKOUR_WITH_COSMETICS
+	CameraEffects = FParkourCameraEffects();
+	AppliedCameraPose = { ParkourState.StandingCameraZOffset, 0.f, 0.f };
+
+	FVector CameraLocation = GetFirstPersonCameraComponent()->GetRelativeLocation();
+	CameraLocation.Z = ParkourState.StandingCameraZOffset;
+	GetFirstPersonCameraComponent()->SetRelativeLocation(CameraLocation);
+	GetFirstPersonCameraComponent()->ClearAdditiveOffset();
+#endif
+
+	SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+
+	SetNetDormancy(DORM_Awake);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	MovementComponent->SetComponentTickEnabled(true);
+	MovementComponent->SetDefaultMovementMode();
+
+	// A Jump Held When the Character was Pooled Must not Fire on Respawn, Nor Count Against the Next One
+	bPressedJump = false;
+	ResetJumpState();
+
+	bPooled = false;
+
+	// Disables the Actor Tick Again Unless a Blueprint Implements It
+	if (bUsesUpdateSubsystem)
+	{
+		if (UParkourUpdateSubsystem* UpdateSubsystem = GetWorld()->GetSubsystem<UParkourUpdateSubsystem>())
+		{
+			UpdateSubsystem->Register(this);
+		}
+	}
+}
+
 // Reset Parameters
 void AParkourSystemCharacter::ResetMovement()
 {
-	if (CurrentParkourMode == EParkourMode::EPM_None || CurrentParkourMode == EParkourMode::EPM_Crouch)
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_None || ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch)
 	{
-		if (CurrentParkourMode == EParkourMode::EPM_Crouch)
+		if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Crouch)
 		{
 			GetCharacterMovement()->MaxWalkSpeed = GetCharacterMovement()->MaxWalkSpeedCrouched;
 		}
 		else
 		{
-			GetCharacterMovement()->MaxWalkSpeed = DefaultWalkSpeed;
+			GetCharacterMovement()->MaxWalkSpeed = ParkourState.DefaultWalkSpeed;
 		}
 
-		GetCharacterMovement()->GroundFriction = DefaultGroundFriction;
-		GetCharacterMovement()->BrakingDecelerationWalking = DefaultBrakingDeceleration;
+		GetCharacterMovement()->GroundFriction = ParkourState.DefaultGroundFriction;
+		GetCharacterMovement()->BrakingDecelerationWalking = ParkourState.DefaultBrakingDeceleration;
 		GetCharacterMovement()->SetPlaneConstraintEnabled(false);
 
-		bool bToWalking = PrevParkourMode == EParkourMode::EPM_None
-			|| PrevParkourMode == EParkourMode::EPM_Sprint
-			|| PrevParkourMode == EParkourMode::EPM_Crouch
-			|| PrevParkourMode == EParkourMode::EPM_Slide;
+		bool bToWalking = ParkourState.PrevParkourMode == EParkourMode::EPM_None
+			|| ParkourState.PrevParkourMode == EParkourMode::EPM_Sprint
+			|| ParkourState.PrevParkourMode == EParkourMode::EPM_Crouch
+			|| ParkourState.PrevParkourMode == EParkourMode::EPM_Slide;
 		if (bToWalking)
 		{
 			GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Walking);
@@ -548,23 +978,23 @@ void AParkourSystemCharacter::ResetMovement()
 // Enable Sprint
 void AParkourSystemCharacter::EnableSprint()
 {
-	bCanSprint = true;
+	ParkourState.bCanSprint = true;
 }
 
 // Disable Sprint
 void AParkourSystemCharacter::DisableSprint()
 {
-	bCanSprint = false;
+	ParkourState.bCanSprint = false;
 }
 
 void AParkourSystemCharacter::EnableSlide()
 {
-	bCanSlide = true;
+	ParkourState.bCanSlide = true;
 }
 
 void AParkourSystemCharacter::DisableSlide()
 {
-	bCanSlide = false;
+	ParkourState.bCanSlide = false;
 }
 
 // Check If Input Vector is Directed Forward
@@ -579,14 +1009,109 @@ bool AParkourSystemCharacter::ForwardInput() const
 	return Cosine > 0.f;
 }
 
+// Get Tuning in Use
+const UParkourTuning& AParkourSystemCharacter::GetTuning() const
+{
+	return Tuning ? *Tuning : *GetDefault<UParkourTuning>();
+}
+
+// Reapply Values Pushed into Components
+void AParkourSystemCharacter::OnTuningChanged(const UParkourTuning* ChangedTuning)
+{
+	if (ChangedTuning != &GetTuning() || !GetCharacterMovement())
+	{
+		return;
+	}
+
+	if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Sprint)
+	{
+		GetCharacterMovement()->MaxWalkSpeed = ChangedTuning->SprintSpeed;
+	}
+	else if (ParkourState.CurrentParkourMode == EParkourMode::EPM_Slide)
+	{
+		// Live Slides Take the New SlideSpeed, Keeping What Momentum Carried into Them
+		ParkourState.SlideMaxSpeed = FMath::Max(ChangedTuning->SlideSpeed, ParkourState.SlideCarriedSpeed);
+		ResolveSlideSurface(GetFloorPhysicalMaterial());
+	}
+}
+
+void AParkourSystemCharacter::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	MigrateDeprecatedTuning();
+#endif
+}
+
+#if WITH_EDITORONLY_DATA
+// Move Overrides Saved Before UParkourTuning into a Tuning Object, so Blueprints Keep Their Values
+void AParkourSystemCharacter::MigrateDeprecatedTuning()
+{
+	struct FMigratedValue
+	{
+		float AParkourSystemCharacter::* Deprecated;
+		float UParkourTuning::* Current;
+	};
+
+	static const FMigratedValue MigratedValues[] =
+	{
+		{ &AParkourSystemCharacter::VerticalJumpForce_DEPRECATED, &UParkourTuning::VerticalJumpForce },
+		{ &AParkourSystemCharacter::HorizontalJumpForce_DEPRECATED, &UParkourTuning::HorizontalJumpForce },
+		{ &AParkourSystemCharacter::SprintSpeed_DEPRECATED, &UParkourTuning::SprintSpeed },
+		{ &AParkourSystemCharacter::SprintJumpForce_DEPRECATED, &UParkourTuning::SprintJumpForce },
+		{ &AParkourSystemCharacter::CrouchCapsuleHalfHeight_DEPRECATED, &UParkourTuning::CrouchCapsuleHalfHeight },
+		{ &AParkourSystemCharacter::CrouchCameraZOffset_DEPRECATED, &UParkourTuning::CrouchCameraZOffset },
+		{ &AParkourSystemCharacter::SlideSpeed_DEPRECATED, &UParkourTuning::SlideSpeed },
+		{ &AParkourSystemCharacter::SlideForceMultiplier_DEPRECATED, &UParkourTuning::SlideForceMultiplier },
+	};
+
+	const UParkourTuning* DefaultTuning = GetDefault<UParkourTuning>();
+
+	bool bHasOverrides = false;
+	for (const FMigratedValue& Value : MigratedValues)
+	{
+		bHasOverrides |= !FMath::IsNearlyEqual(this->*Value.Deprecated, DefaultTuning->*Value.Current);
+	}
+
+	if (!bHasOverrides)
+	{
+		return;
+	}
+
+	if (Tuning != nullptr)
+	{
+		UE_LOG(LogTemplateCharacter, Warning, TEXT("%s has per-character tuning saved before UParkourTuning, but uses %s, which wins"), *GetPathName(), *Tuning->GetPathName());
+	}
+	else
+	{
+		UParkourTuning* MigratedTuning = NewObject<UParkourTuning>(this, TEXT("MigratedTuning"), RF_Transactional);
+		for (const FMigratedValue& Value : MigratedValues)
+		{
+			MigratedTuning->*Value.Current = this->*Value.Deprecated;
+		}
+		MigratedTuning->RecomputeDerivedValues();
+		Tuning = MigratedTuning;
+
+		UE_LOG(LogTemplateCharacter, Warning, TEXT("Moved per-character tuning of %s into %s, resave it or assign a shared tuning asset"), *GetPathName(), *MigratedTuning->GetPathName());
+	}
+
+	// Migrate Only Once
+	for (const FMigratedValue& Value : MigratedValues)
+	{
+		this->*Value.Deprecated = DefaultTuning->*Value.Current;
+	}
+}
+#endif
+
 // Check If Sprint or Slide Queued, and Start Respective Action
 void AParkourSystemCharacter::CheckQueues()
 {
-	if (bIsSlideQueued)
+	if (ParkourState.bIsSlideQueued)
 	{
 		SlideStart();
 	}
-	else if (bIsSprintQueued)
+	else if (ParkourState.bIsSprintQueued)
 	{
 		SprintStart();
 	}
@@ -595,6 +1120,7 @@ void AParkourSystemCharacter::CheckQueues()
 void AParkourSystemCharacter::SetHasRifle(bool bNewHasRifle)
 {
 	bHasRifle = bNewHasRifle;
+	AnimState.bHasRifle = bNewHasRifle;
 }
 
 bool AParkourSystemCharacter::GetHasRifle()
@@ -5,7 +5,13 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Logging/LogMacros.h"
+#include "ParkourAnimState.h"
+#include "ParkourCameraEffects.h"
+#include "ParkourCooldowns.h"
+#include "ParkourInputBuffer.h"
 #include "ParkourMode.h"
+#include "ParkourMomentum.h"
+#include "ParkourState.h"
 #include "ParkourSystemCharacter.generated.h"
 
 class UInputComponent;
@@ -13,6 +19,10 @@ class USkeletalMeshComponent;
 class UCameraComponent;
 class UInputAction;
 class UInputMappingContext;
+class UParkourTuning;
+class UPhysicalMaterial;
+enum class EParkourLatencyProbe : uint8;
+struct FParkourUpdateFrame;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
@@ -43,11 +53,26 @@ class AParkourSystemCharacter : public ACharacter
 	UInputAction* MoveAction;
 	
 public:
-	AParkourSystemCharacter();
+	AParkourSystemCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:
 	virtual void BeginPlay();
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Set up or Tear Down First Person Presentation When Local Control Changes
+	virtual void NotifyControllerChanged() override;
+
+	// Register Mesh1P and Add Input Mapping Context While Locally Controlled, Unregister Mesh1P Otherwise
+	void SetupLocalPresentation();
+
+	// Move Held Weapons onto the Component GetWeaponAttachParent() Now Returns
+	void ReattachWeapons();
+
+public:
+	// Component and Socket a Held Weapon Attaches to, Mesh1P Only While It is Registered and Updating
+	USceneComponent* GetWeaponAttachParent(FName& OutSocketName) const;
+
 public:
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -63,7 +88,7 @@ public:
 
 	/** Bool for AnimBP to switch to another animation set */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Weapon)
-	bool bHasRifle;
+	uint8 bHasRifle : 1;
 
 	/** Setter to set the bool */
 	UFUNCTION(BlueprintCallable, Category = Weapon)
@@ -73,7 +98,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = Weapon)
 	bool GetHasRifle();
 
-protected:
+public:
 	/** Called for movement input */
 	void Move(const FInputActionValue& Value);
 
@@ -83,12 +108,13 @@ protected:
 public:
 	/** MovementMode Functions and Variables */
 
-	EMovementMode CurrentMovementMode;
-	EMovementMode PreviousMovementMode;
-	
 	// Called When Movement Mode is Changed
 	virtual void OnMovementModeChanged(EMovementMode InPrevMovementMode, uint8 PreviousCustomMode) override;
 
+protected:
+	// Presses Resolved on Movement Mode Changes, and the Coyote Window
+	FParkourInputBuffer InputBuffer;
+
 protected:
 	/** ParkourMode Functions and Variables */
 
@@ -100,17 +126,37 @@ protected:
 	// Reset Parameters Changed In Parkour Action
 	void ResetMovement();
 
-	EParkourMode CurrentParkourMode;
-	EParkourMode PrevParkourMode;
+public:
+	/** Functions Related to Respawn Pooling */
+
+	// Hide and Stop Updating While Kept in the Game Mode's Pool, Defaults Cached at BeginPlay are Kept
+	void DeactivateForPool();
+
+	// Reset Parkour State to That of a Fresh Spawn at SpawnTransform and Resume Updating
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
+	// If the Character is Kept in the Pool, Hidden and not Updating
+	bool IsPooled() const { return bPooled; }
 
 protected:
-	/** Functions and Variables Related to Enabling and Disabling Parkour */
+	// If the Character is Between DeactivateForPool and ActivateFromPool
+	uint8 bPooled : 1;
 
-	// If Character Can Sprint
-	bool bCanSprint;
+	// Modes, Flags and Cached Defaults Packed Together
+	FParkourState ParkourState;
+
+public:
+	// Get Current ParkourMode
+	EParkourMode GetParkourMode() const { return ParkourState.CurrentParkourMode; }
+
+	// Get Packed Parkour State
+	const FParkourState& GetParkourState() const { return ParkourState; }
+
+protected:
+	/** Functions and Variables Related to Enabling and Disabling Parkour */
 
-	// TimerHandle for Sprint
-	FTimerHandle SprintTimerHandle;
+	// Cooldowns Checked Against World Time
+	FParkourCooldowns Cooldowns;
 
 	// Enable Sprint
 	void EnableSprint();
@@ -118,12 +164,6 @@ protected:
 	// Disable Sprint
 	void DisableSprint();
 
-	// If Character Can Slide
-	bool bCanSlide;
-
-	// TimerHandle for Slide
-	FTimerHandle SlideTimerHandle;
-
 	// Enable Slide
 	void EnableSlide();
 
@@ -140,40 +180,88 @@ protected:
 	void CheckQueues();
 
 public:
-	/** Variables and Functions Related To Jump */
+	/** Tuning Shared Among Characters */
+
+	// Tuning Asset, Class Default is Used If Not Set
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Parkour)
+	UParkourTuning* Tuning;
+
+	// Get Tuning in Use
+	const UParkourTuning& GetTuning() const;
+
+protected:
+	// Reapply Values Pushed into Components When Tuning Asset was Edited
+	void OnTuningChanged(const UParkourTuning* ChangedTuning);
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITORONLY_DATA
+private:
+	/** Per-Character Tuning Saved Before UParkourTuning, Moved into Tuning on Load */
+
+	UPROPERTY()
+	float VerticalJumpForce_DEPRECATED;
 
-	// If Player Can Jump Twice
-	bool bCanDoubleJump;
+	UPROPERTY()
+	float HorizontalJumpForce_DEPRECATED;
 
-	// Upward Force of Jumping
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Jump)
-	float VerticalJumpForce;
+	UPROPERTY()
+	float SprintSpeed_DEPRECATED;
 
-	// Horizontal Force of Jumping
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Jump)
-	float HorizontalJumpForce;
+	UPROPERTY()
+	float SprintJumpForce_DEPRECATED;
+
+	UPROPERTY()
+	float CrouchCapsuleHalfHeight_DEPRECATED;
+
+	UPROPERTY()
+	float CrouchCameraZOffset_DEPRECATED;
+
+	UPROPERTY()
+	float SlideSpeed_DEPRECATED;
+
+	UPROPERTY()
+	float SlideForceMultiplier_DEPRECATED;
+
+	// Move Overrides of the Deprecated Values into a Tuning Object Owned by This Character
+	void MigrateDeprecatedTuning();
+#endif
+
+public:
+	/** Variables and Functions Related To Jump */
 
 	// Jump(Including Double Jumping)
 	virtual void Jump() override;
 
 public:
-	/** Variables and Functions Related To Sprint */
+	/** Variables and Functions Related To Momentum */
 
-	// Input Action for Sprint
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input)
-	UInputAction* SprintAction;
+	// Stats of the Chain in Progress
+	const FParkourChainStats& GetCurrentMomentumChain() const { return Momentum.GetCurrentChain(); }
+
+	// Stats of the Last Finished Chain
+	const FParkourChainStats& GetLastMomentumChain() const { return Momentum.GetLastChain(); }
 
-	// Speed of Sprint
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Sprint)
-	float SprintSpeed;
+protected:
+	// Speed Carried Through Slide, Jump and Land
+	FParkourMomentum Momentum;
+
+	// Add a Link to the Momentum Chain
+	//! @return Speed Carried into the Link
+	float AddMomentumLink(float BonusSpeed);
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Sprint)
-	float SprintJumpForce;
+	// Finish the Momentum Chain
+	void EndMomentumChain();
 
-	float DefaultWalkSpeed;
+	// Launch Horizontally with the Carried Speed When Jumping from the Ground
+	void MomentumJumpThrust();
 
-	// Whether Sprint is Queued
-	bool bIsSprintQueued;
+public:
+	/** Variables and Functions Related To Sprint */
+
+	// Input Action for Sprint
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input)
+	UInputAction* SprintAction;
 
 	// Start Sprint
 	void SprintStart();
@@ -184,9 +272,6 @@ public:
 	// Check If Player Can Sprint
 	bool CanSprint() const;
 
-	// Update and Check the State
-	void SprintUpdate();
-
 	// Fired When Sprint Key was Pressed
 	void Sprint();
 
@@ -200,25 +285,52 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input)
 	UInputAction* CrouchAction;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Crouch)
-	float CrouchCapsuleHalfHeight;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Crouch)
-	float CrouchCameraZOffset;
-
-	float StandingCapsuleHalfHeight;
-
-	float StandingCameraZOffset;
-
 	// Start Crouch
 	void CrouchStart();
 
 	// Finish Crouch
 	void CrouchEnd();
 
-	// Called Every Frame with Regard to Crouching, Mainly so that Parameters get updated
-	void CrouchUpdate();
+public:
+	/** Variables and Functions Related to Per-Frame Update */
+
+	// Read Everything the Per-Frame Update Needs, Game Thread Only
+	void GatherParkourUpdate(FParkourUpdateFrame& Frame);
+
+	// Write Results of the Per-Frame Update Back, Game Thread Only
+	void ApplyParkourUpdate(const FParkourUpdateFrame& Frame, float DeltaSeconds);
+
+protected:
+	// If UParkourUpdateSubsystem Updates This Character Instead of Tick
+	uint8 bUsesUpdateSubsystem : 1;
+
+public:
+	/** Variables and Functions Related to Animation */
+
+	// State Copied by UParkourAnimInstance, Safe to Hand to Worker Threads Once Copied
+	const FParkourAnimState& GetAnimState() const { return AnimState; }
+
+protected:
+	// Refresh AnimState from This Frame's Update, Game Thread Only
+	void PublishAnimState(const FParkourUpdateFrame& Frame);
+
+	// Published Once per Frame in ApplyParkourUpdate()
+	FParkourAnimState AnimState;
+
+public:
+	/** Variables and Functions Related to Camera Effects */
+
+	// Called Every Frame for Locally Controlled Characters Only, Writes the Camera Once
+	void CameraUpdate(float DeltaSeconds);
+
+protected:
+	// Crouch Height, Landing Dip, FOV Kick and Slide Roll
+	FParkourCameraEffects CameraEffects;
 
+	// Pose Last Written to the Camera
+	FParkourCameraPose AppliedCameraPose = { 0.f, 0.f, 0.f };
+
+public:
 	// Processing with Regard to Jumping While Crouching
 	void CrouchJump();
 
@@ -234,29 +346,17 @@ public:
 public:
 	/** Variables and Functions Related to Slide */
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Slide)
-	float SlideSpeed;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Slide)
-	float SlideForceMultiplier;
-
-	// Ground Friction by Default
-	float DefaultGroundFriction;
-
-	// Braking Deceleration by Default
-	float DefaultBrakingDeceleration;
-
-	// If Sliding is Queued
-	bool bIsSlideQueued;
-
 	// Start Slide
 	void SlideStart();
 
 	// Finish Slide
 	void SlideEnd();
 
-	// Called Every Frame with Regard to Sliding
-	void SlideUpdate();
+	// Physical Material of the Current Floor, Including One Assigned Through Its Material
+	const UPhysicalMaterial* GetFloorPhysicalMaterial() const;
+
+	// Look up How the Floor Affects Sliding, Called Only When the Floor's Physical Material Changes
+	void ResolveSlideSurface(const UPhysicalMaterial* PhysicalMaterial);
 
 	// Check If Player Can Slide
 	bool CanSlide();
@@ -273,7 +373,11 @@ protected:
 	// End of APawn interface
 
 public:
-	/** Returns Mesh1P subobject **/
+	// Tag a Press for Latency Measurement While parkour.LatencyTrace is Set, Before the Action Runs
+	void TagLatencyProbe(EParkourLatencyProbe Probe);
+
+public:
+	/** Returns Mesh1P subobject, not registered unless locally controlled **/
 	USkeletalMeshComponent* GetMesh1P() const { return Mesh1P; }
 	/** Returns FirstPersonCameraComponent subobject **/
 	UCameraComponent* GetFirstPersonCameraComponent() const { return FirstPersonCameraComponent; }
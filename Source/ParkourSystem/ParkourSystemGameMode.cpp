@@ -2,13 +2,140 @@
 
 #include "ParkourSystemGameMode.h"
 #include "ParkourSystemCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "HAL/IConsoleManager.h"
 #include "UObject/ConstructorHelpers.h"
 
+static TAutoConsoleVariable<bool> CVarParkourRespawnPool(
+	TEXT("parkour.RespawnPool"),
+	true,
+	TEXT("Respawn players with pre-warmed characters from the game mode's pool instead of spawning new ones."));
+
 AParkourSystemGameMode::AParkourSystemGameMode()
 	: Super()
+	, PrewarmedCharacterCount(8)
+	, MaxPooledCharacters(64)
 {
 	// set default pawn class to our Blueprinted character
 	static ConstructorHelpers::FClassFinder<APawn> PlayerPawnClassFinder(TEXT("/Game/FirstPerson/Blueprints/BP_FirstPersonCharacter"));
 	DefaultPawnClass = PlayerPawnClassFinder.Class;
 
 }
+
+void AParkourSystemGameMode::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (CVarParkourRespawnPool.GetValueOnGameThread())
+	{
+		PrewarmCharacterPool(PrewarmedCharacterCount);
+	}
+}
+
+// Spawn Characters into the Pool Until It Holds Count
+void AParkourSystemGameMode::PrewarmCharacterPool(int32 Count)
+{
+	UClass* CharacterClass = DefaultPawnClass;
+	if (CharacterClass == nullptr || !CharacterClass->IsChildOf(AParkourSystemCharacter::StaticClass()))
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParams.ObjectFlags |= RF_Transient;
+
+	Count = FMath::Min(Count, MaxPooledCharacters);
+	CharacterPool.Reserve(Count);
+	while (CharacterPool.Num() < Count)
+	{
+		// BeginPlay Runs Here, Caching Defaults Once for the Character's Whole Life
+		AParkourSystemCharacter* Character = GetWorld()->SpawnActor<AParkourSystemCharacter>(CharacterClass, FTransform::Identity, SpawnParams);
+		if (Character == nullptr)
+		{
+			return;
+		}
+
+		Character->DeactivateForPool();
+		CharacterPool.Add(Character);
+	}
+}
+
+// Take a Character from the Pool When One of the Right Class is Available
+APawn* AParkourSystemGameMode::SpawnDefaultPawnAtTransform_Implementation(AController* NewPlayer, const FTransform& SpawnTransform)
+{
+	if (CVarParkourRespawnPool.GetValueOnGameThread())
+	{
+		const UClass* PawnClass = GetDefaultPawnClassForController(NewPlayer);
+		for (int32 Index = CharacterPool.Num() - 1; Index >= 0; --Index)
+		{
+			AParkourSystemCharacter* Character = CharacterPool[Index];
+			// Destroyed Characters Wait in the Pool Until Collected, and are Never Handed Out
+			if (!IsValid(Character))
+			{
+				CharacterPool.RemoveAtSwap(Index);
+				continue;
+			}
+
+			if (Character->GetClass() != PawnClass)
+			{
+				continue;
+			}
+
+			CharacterPool.RemoveAtSwap(Index);
+			Character->SetInstigator(GetInstigator());
+			Character->ActivateFromPool(SpawnTransform);
+			return Character;
+		}
+	}
+
+	return Super::SpawnDefaultPawnAtTransform_Implementation(NewPlayer, SpawnTransform);
+}
+
+// Put an Unpossessed Character into the Pool
+void AParkourSystemGameMode::ReleaseCharacter(AParkourSystemCharacter* Character)
+{
+	if (Character == nullptr)
+	{
+		return;
+	}
+
+	if (!CVarParkourRespawnPool.GetValueOnGameThread() || CharacterPool.Num() >= MaxPooledCharacters)
+	{
+		Character->Destroy();
+		return;
+	}
+
+	Character->DeactivateForPool();
+	CharacterPool.Add(Character);
+}
+
+// Destroy Pooled Characters Beyond MaxPooledCharacters
+void AParkourSystemGameMode::TrimCharacterPool()
+{
+	while (CharacterPool.Num() > MaxPooledCharacters)
+	{
+		if (AParkourSystemCharacter* Character = CharacterPool.Pop())
+		{
+			Character->Destroy();
+		}
+	}
+}
+
+// Return the Controller's Character to the Pool and Restart the Player
+void AParkourSystemGameMode::RespawnPlayer(AController* Controller)
+{
+	if (Controller == nullptr)
+	{
+		return;
+	}
+
+	if (AParkourSystemCharacter* Character = Cast<AParkourSystemCharacter>(Controller->GetPawn()))
+	{
+		Controller->UnPossess();
+		ReleaseCharacter(Character);
+	}
+
+	RestartPlayer(Controller);
+}
@@ -6,6 +6,8 @@
 #include "GameFramework/GameModeBase.h"
 #include "ParkourSystemGameMode.generated.h"
 
+class AParkourSystemCharacter;
+
 UCLASS(minimalapi)
 class AParkourSystemGameMode : public AGameModeBase
 {
@@ -13,6 +15,42 @@ class AParkourSystemGameMode : public AGameModeBase
 
 public:
 	AParkourSystemGameMode();
+
+	// Take a Character from the Pool When One of the Right Class is Available, Otherwise Spawn as Usual
+	virtual APawn* SpawnDefaultPawnAtTransform_Implementation(AController* NewPlayer, const FTransform& SpawnTransform) override;
+
+protected:
+	virtual void BeginPlay() override;
+
+public:
+	/** Variables and Functions Related to Respawn Pooling */
+
+	// Characters Spawned into the Pool at BeginPlay, so Respawns Skip Construction and BeginPlay
+	UPROPERTY(EditDefaultsOnly, Category = Respawn, meta = (ClampMin = "0"))
+	int32 PrewarmedCharacterCount;
+
+	// Characters Released Beyond This are Destroyed
+	UPROPERTY(EditDefaultsOnly, Category = Respawn, meta = (ClampMin = "0"))
+	int32 MaxPooledCharacters;
+
+	// Return the Controller's Character to the Pool and Restart the Player with a Pooled One
+	UFUNCTION(BlueprintCallable, Category = Respawn)
+	void RespawnPlayer(AController* Controller);
+
+	// Spawn Characters into the Pool Until It Holds Count
+	void PrewarmCharacterPool(int32 Count);
+
+	// Put an Unpossessed Character into the Pool, Destroyed Instead If the Pool is Full or Disabled
+	void ReleaseCharacter(AParkourSystemCharacter* Character);
+
+	// Destroy Pooled Characters Beyond MaxPooledCharacters, After the Cap was Lowered
+	void TrimCharacterPool();
+
+	int32 GetNumPooledCharacters() const { return CharacterPool.Num(); }
+
+protected:
+	UPROPERTY(Transient)
+	TArray<AParkourSystemCharacter*> CharacterPool;
 };
 
 
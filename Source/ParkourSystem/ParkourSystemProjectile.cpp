@@ -1,10 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ParkourSystemProjectile.h"
-#include "GameFramework/ProjectileMovementComponent.h"
+#include "ParkourProjectileMovementComponent.h"
 #include "Components/SphereComponent.h"
+#include "ParkourProjectileHitSubsystem.h"
 
 AParkourSystemProjectile::AParkourSystemProjectile() 
+	: bRetired(false)
 {
 	// Use a sphere as a simple collision representation
 	CollisionComp = CreateDefaultSubobject<USphereComponent>(TEXT("SphereComp"));
@@ -19,8 +21,8 @@ AParkourSystemProjectile::AParkourSystemProjectile()
 	// Set as root component
 	RootComponent = CollisionComp;
 
-	// Use a ProjectileMovementComponent to govern this projectile's movement
-	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>(TEXT("ProjectileComp"));
+	// Use a ProjectileMovementComponent to govern this projectile's movement, Substepped Only Where the Path Crosses Geometry
+	ProjectileMovement = CreateDefaultSubobject<UParkourProjectileMovementComponent>(TEXT("ProjectileComp"));
 	ProjectileMovement->UpdatedComponent = CollisionComp;
 	ProjectileMovement->InitialSpeed = 3000.f;
 	ProjectileMovement->MaxSpeed = 3000.f;
@@ -34,10 +36,30 @@ AParkourSystemProjectile::AParkourSystemProjectile()
 void AParkourSystemProjectile::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
 	// Only add impulse and destroy projectile if we hit a physics
-	if ((OtherActor != nullptr) && (OtherActor != this) && (OtherComp != nullptr) && OtherComp->IsSimulatingPhysics())
+	if (!bRetired && (OtherActor != nullptr) && (OtherActor != this) && (OtherComp != nullptr) && OtherComp->IsSimulatingPhysics())
 	{
-		OtherComp->AddImpulseAtLocation(GetVelocity() * 100.0f, GetActorLocation());
+		// Impulse and destruction are batched with other hits at the end of the frame
+		if (UParkourProjectileHitSubsystem* HitSubsystem = GetWorld()->GetSubsystem<UParkourProjectileHitSubsystem>())
+		{
+			HitSubsystem->QueueImpulse(OtherComp, GetVelocity() * 100.0f, GetActorLocation());
+			HitSubsystem->QueueRetire(this);
 
-		Destroy();
+			Retire();
+		}
+		else
+		{
+			OtherComp->AddImpulseAtLocation(GetVelocity() * 100.0f, GetActorLocation());
+
+			Destroy();
+		}
 	}
+}
+
+void AParkourSystemProjectile::Retire()
+{
+	bRetired = true;
+
+	ProjectileMovement->StopMovementImmediately();
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
 }
\ No newline at end of file
@@ -29,9 +29,19 @@ public:
 	UFUNCTION()
 	void OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
 
+	/** Stops movement and collision until the projectile is destroyed at the end of the frame */
+	void Retire();
+
+	/** Returns true once the projectile was retired **/
+	bool IsRetired() const { return bRetired; }
+
 	/** Returns CollisionComp subobject **/
 	USphereComponent* GetCollisionComp() const { return CollisionComp; }
 	/** Returns ProjectileMovement subobject **/
 	UProjectileMovementComponent* GetProjectileMovement() const { return ProjectileMovement; }
+
+private:
+	/** Set when the projectile has hit and waits for the end-of-frame batch */
+	bool bRetired;
 };
 
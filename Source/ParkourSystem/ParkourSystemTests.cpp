@@ -0,0 +1,926 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourBotController.h"
+#include "ParkourNavLinkData.h"
+#include "ParkourNavLinkProxy.h"
+#include "ParkourProjectileMovementComponent.h"
+#include "ParkourReplay.h"
+#include "ParkourRoute.h"
+#include "ParkourSlideKernel.h"
+#include "ParkourSystemCharacter.h"
+#include "ParkourSystemProjectile.h"
+#include "ParkourTestFixture.h"
+#include "ParkourTrajectorySolver.h"
+#include "ParkourTuning.h"
+#include "ParkourUpdateFrame.h"
+#include "Components/BrushComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NavigationSystem.h"
+#include "NavMesh/NavMeshBoundsVolume.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ParkourSystemTests
+{
+	static TAutoConsoleVariable<float> CVarTransitionBudgetMs(
+		TEXT("parkour.TransitionBudgetMs"),
+		1.f,
+		TEXT("Time budget of a single sequence run by the Parkour.Transitions automation test, in milliseconds."));
+
+	// State a Transition Sequence Must End in
+	struct FTransitionExpectation
+	{
+		EParkourMode Mode;
+		float MaxWalkSpeed;
+		float GroundFriction;
+		float CapsuleHalfHeight;
+	};
+
+	struct FTransitionSequence
+	{
+		const TCHAR* Name;
+		TFunction<void(AParkourSystemCharacter&)> Run;
+		TFunction<FTransitionExpectation(const AParkourSystemCharacter&)> Expect;
+	};
+
+	static const TArray<FTransitionSequence>& GetTransitionSequences()
+	{
+		using ParkourTestFixture::HoldForward;
+
+		static const TArray<FTransitionSequence> Sequences =
+		{
+			{
+				TEXT("Sprint Jump Land Sprint"),
+				[](AParkourSystemCharacter& Character)
+				{
+					HoldForward(Character);
+					Character.Sprint();
+					Character.Jump();
+					Character.GetCharacterMovement()->SetMovementMode(MOVE_Falling);
+					Character.GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+					Character.StopJumping();
+				},
+				[](const AParkourSystemCharacter& Character) -> FTransitionExpectation
+				{
+					return { EParkourMode::EPM_Sprint, Character.GetTuning().SprintSpeed, Character.GetParkourState().DefaultGroundFriction, Character.GetParkourState().StandingCapsuleHalfHeight };
+				}
+			},
+			{
+				TEXT("Sprint Jump Slide Queued Land Slide"),
+				[](AParkourSystemCharacter& Character)
+				{
+					HoldForward(Character);
+					Character.Sprint();
+					Character.Jump();
+					Character.GetCharacterMovement()->SetMovementMode(MOVE_Falling);
+					Character.CrouchSlideKeyPressed();
+					Character.GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+					Character.StopJumping();
+				},
+				[](const AParkourSystemCharacter& Character) -> FTransitionExpectation
+				{
+					return { EParkourMode::EPM_Slide, 0.f, 0.f, Character.GetTuning().CrouchCapsuleHalfHeight };
+				}
+			},
+			{
+				TEXT("Crouch"),
+				[](AParkourSystemCharacter& Character)
+				{
+					Character.CrouchSlideKeyPressed();
+				},
+				[](const AParkourSystemCharacter& Character) -> FTransitionExpectation
+				{
+					return { EParkourMode::EPM_Crouch, Character.GetCharacterMovement()->MaxWalkSpeedCrouched, Character.GetParkourState().DefaultGroundFriction, Character.GetTuning().CrouchCapsuleHalfHeight };
+				}
+			},
+			{
+				TEXT("Crouch Stand"),
+				[](AParkourSystemCharacter& Character)
+				{
+					Character.CrouchSlideKeyPressed();
+					Character.CrouchSlideKeyPressed();
+				},
+				[](const AParkourSystemCharacter& Character) -> FTransitionExpectation
+				{
+					return { EParkourMode::EPM_None, Character.GetParkourState().DefaultWalkSpeed, Character.GetParkourState().DefaultGroundFriction, Character.GetParkourState().StandingCapsuleHalfHeight };
+				}
+			},
+			{
+				TEXT("Sprint Sprint Key Walk"),
+				[](AParkourSystemCharacter& Character)
+				{
+					HoldForward(Character);
+					Character.Sprint();
+					Character.Sprint();
+				},
+				[](const AParkourSystemCharacter& Character) -> FTransitionExpectation
+				{
+					return { EParkourMode::EPM_None, Character.GetParkourState().DefaultWalkSpeed, Character.GetParkourState().DefaultGroundFriction, Character.GetParkourState().StandingCapsuleHalfHeight };
+				}
+			},
+		};
+
+		return Sequences;
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FParkourTransitionsTest, "Parkour.Transitions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+void FParkourTransitionsTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const ParkourSystemTests::FTransitionSequence& Sequence : ParkourSystemTests::GetTransitionSequences())
+	{
+		OutBeautifiedNames.Add(Sequence.Name);
+		OutTestCommands.Add(Sequence.Name);
+	}
+}
+
+// Run a Transition Sequence on a Fresh Character, then Check Its State and Time Budget
+bool FParkourTransitionsTest::RunTest(const FString& Parameters)
+{
+	using namespace ParkourSystemTests;
+
+	const FTransitionSequence* Sequence = GetTransitionSequences().FindByPredicate([&Parameters](const FTransitionSequence& Candidate)
+	{
+		return Parameters == Candidate.Name;
+	});
+	if (!TestNotNull(TEXT("Sequence"), Sequence))
+	{
+		return false;
+	}
+
+	UWorld* World = ParkourTestFixture::CreateWorld(TEXT("ParkourTransitionsTest"));
+	AParkourSystemCharacter* Character = ParkourTestFixture::SpawnCharacter(World);
+	if (TestNotNull(TEXT("Character"), Character))
+	{
+		Character->GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		Sequence->Run(*Character);
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+		const FTransitionExpectation Expected = Sequence->Expect(*Character);
+		const UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
+
+		TestEqual(TEXT("Parkour mode"), static_cast<int32>(Character->GetParkourMode()), static_cast<int32>(Expected.Mode));
+		TestEqual(TEXT("MaxWalkSpeed"), MovementComponent->MaxWalkSpeed, Expected.MaxWalkSpeed);
+		TestEqual(TEXT("GroundFriction"), MovementComponent->GroundFriction, Expected.GroundFriction);
+
+		// Let Capsule Height Settle Through the Per-Frame Update, as UParkourUpdateSubsystem Runs It
+		constexpr float DeltaSeconds = 1.f / 60.f;
+		for (int32 Step = 0; Step < 300; ++Step)
+		{
+			FParkourUpdateFrame Frame;
+			Character->GatherParkourUpdate(Frame);
+			Frame.Compute(DeltaSeconds);
+			Character->ApplyParkourUpdate(Frame, DeltaSeconds);
+		}
+
+		TestEqual(TEXT("Capsule half height"), Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight(), Expected.CapsuleHalfHeight, 0.5f);
+
+		const float BudgetMs = CVarTransitionBudgetMs.GetValueOnGameThread();
+		TestTrue(FString::Printf(TEXT("Took %.3f ms, budget %.3f ms"), ElapsedMs, BudgetMs), ElapsedMs <= BudgetMs);
+		AddInfo(FString::Printf(TEXT("%s took %.3f ms"), Sequence->Name, ElapsedMs));
+	}
+
+	ParkourTestFixture::DestroyWorld(World);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParkourSlideKernelTest, "Parkour.SlideKernel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// FParkourSlideKernel Matches the Slide Step It Replaced
+bool FParkourSlideKernelTest::RunTest(const FString& Parameters)
+{
+	const UParkourTuning& Tuning = *GetDefault<UParkourTuning>();
+
+	int32 NumMismatched = 0;
+	FRandomStream Stream(10000);
+	for (int32 Index = 0; Index < 10000; ++Index)
+	{
+		const FVector Velocity = Stream.GetUnitVector() * Stream.FRandRange(0.f, 2.f * Tuning.SlideSpeed);
+		const FVector FloorNormal = FVector(Stream.FRandRange(-0.5f, 0.5f), Stream.FRandRange(-0.5f, 0.5f), 1.f).GetSafeNormal();
+
+		FVector LegacyForce;
+		bool bLegacyShouldEnd = false;
+		const FVector LegacyVelocity = ParkourTestFixture::LegacySlideStep(Velocity, FloorNormal, Tuning, LegacyForce, bLegacyShouldEnd);
+		const FParkourSlideKernel::FResult Result = FParkourSlideKernel::Step(Velocity, FloorNormal, Tuning);
+
+		const bool bMatches = Result.Velocity.Equals(LegacyVelocity, 1e-2)
+			&& Result.Force.Equals(LegacyForce, LegacyForce.Size() * 1e-4 + 1e-2)
+			&& Result.bShouldEnd == bLegacyShouldEnd;
+
+		if (!bMatches && ++NumMismatched <= 5)
+		{
+			AddError(FString::Printf(TEXT("Velocity %s on floor %s: kernel %s force %s, legacy %s force %s"),
+				*Velocity.ToString(), *FloorNormal.ToString(), *Result.Velocity.ToString(), *Result.Force.ToString(), *LegacyVelocity.ToString(), *LegacyForce.ToString()));
+		}
+	}
+
+	TestEqual(TEXT("Mismatched slide steps"), NumMismatched, 0);
+	return true;
+}
+
+// Links are Built in the Editor Only
+#if WITH_EDITOR && WITH_RECAST
+namespace ParkourSystemTests
+{
+	// Nav Mesh Bounds Around a Box, Spawned Before Begin Play so that Navigation Gathers Them
+	static void SpawnNavBounds(UWorld* World, const FBox& Bounds)
+	{
+		const FTransform Transform(Bounds.GetCenter());
+		ANavMeshBoundsVolume* Volume = World->SpawnActorDeferred<ANavMeshBoundsVolume>(ANavMeshBoundsVolume::StaticClass(), Transform);
+
+		// Volumes Spawned at Runtime Have No Brush Model, so Their Bounds Come from a Convex Body
+		FKConvexElem ConvexElem;
+		const FVector Extent = Bounds.GetExtent();
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			ConvexElem.VertexData.Add(FVector(Corner & 1 ? Extent.X : -Extent.X, Corner & 2 ? Extent.Y : -Extent.Y, Corner & 4 ? Extent.Z : -Extent.Z));
+		}
+		ConvexElem.UpdateElemBox();
+
+		UBodySetup* BodySetup = NewObject<UBodySetup>(Volume->GetBrushComponent());
+		BodySetup->AggGeom.ConvexElems.Add(ConvexElem);
+		Volume->GetBrushComponent()->BrushBodySetup = BodySetup;
+
+		Volume->FinishSpawning(Transform);
+	}
+
+	// Nav Mesh Game Worlds can Build, Spawned Before Begin Play so that Navigation is not Configured as Static
+	static void SpawnDynamicNavMesh(UWorld* World)
+	{
+		ARecastNavMesh* NavMesh = World->SpawnActorDeferred<ARecastNavMesh>(ARecastNavMesh::StaticClass(), FTransform::Identity);
+
+		// Only Exposed to the Details Panel, and Project Nav Meshes are Static at Runtime
+		if (const FEnumProperty* RuntimeGeneration = FindFProperty<FEnumProperty>(ANavigationData::StaticClass(), TEXT("RuntimeGeneration")))
+		{
+			*RuntimeGeneration->ContainerPtrToValuePtr<ERuntimeGenerationType>(NavMesh) = ERuntimeGenerationType::Dynamic;
+		}
+
+		NavMesh->FinishSpawning(FTransform::Identity);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParkourNavLinksTest, "Parkour.NavLinks", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// A Bot Crosses a Crouch Tunnel and a Double Jump Gap Using Links BuildLinks Found on a Small Course
+bool FParkourNavLinksTest::RunTest(const FString& Parameters)
+{
+	using namespace ParkourSystemTests;
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("ParkourNavLinksTest"));
+	World->AddToRoot();
+
+	// Course is Sized Once the Game Mode Picks the Character, so the Bounds Leave Room for Any Gap
+	const FBox CourseBounds(FVector(-1000.f, -600.f, -200.f), FVector(10000.f, 600.f, 600.f));
+	SpawnNavBounds(World, CourseBounds);
+	SpawnDynamicNavMesh(World);
+	ParkourTestFixture::StartWorld(World);
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (!TestNotNull(TEXT("Navigation system"), NavSys))
+	{
+		ParkourTestFixture::DestroyWorld(World);
+		return false;
+	}
+
+	// Course Sized from the Same Character and Tuning the Links are Built for
+	UClass* CharacterClass = ParkourTestFixture::GetCharacterClass(World);
+	const AParkourSystemCharacter* CharacterDefaults = CharacterClass->GetDefaultObject<AParkourSystemCharacter>();
+	const UParkourTuning& Tuning = CharacterDefaults->GetTuning();
+	const UCharacterMovementComponent* MovementDefaults = CharacterDefaults->GetCharacterMovement();
+
+	const float Radius = CharacterDefaults->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
+	const float StandingHalfHeight = CharacterDefaults->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	const float Gravity = FMath::Abs(World->GetGravityZ() * MovementDefaults->GravityScale);
+	const float RiseTime = MovementDefaults->JumpZVelocity / Gravity;
+	const float JumpHeight = FMath::Square(MovementDefaults->JumpZVelocity) / (2.f * Gravity);
+	const float JumpLength = MovementDefaults->MaxWalkSpeed * 2.f * RiseTime;
+	const float DoubleJumpFallTime = (Tuning.VerticalJumpForce + FMath::Sqrt(FMath::Square(Tuning.VerticalJumpForce) + 2.f * Gravity * JumpHeight)) / Gravity;
+	const float DoubleJumpLength = MovementDefaults->MaxWalkSpeed * RiseTime + (MovementDefaults->MaxWalkSpeed + Tuning.HorizontalJumpForce) * DoubleJumpFallTime;
+
+	// Ceiling Between the Crouched and Standing Heights, and a Gap Only the Double Jump Clears, Measured Between Nav Mesh Edges
+	const float TunnelClearance = Tuning.CrouchCapsuleHalfHeight + StandingHalfHeight;
+	const float GapLength = 0.5f * (JumpLength + DoubleJumpLength) - 2.f * Radius;
+	const float GapStart = 1000.f;
+	const float FarFloorStart = GapStart + GapLength;
+
+	// Floor Before the Gap with the Tunnel on It, and Floor After the Gap, Long Enough to Land on After Any Overshoot
+	ParkourTestFixture::SpawnBox(World, FVector(250.f, 0.f, -50.f), FVector(750.f, 300.f, 50.f));
+	ParkourTestFixture::SpawnBox(World, FVector(400.f, 0.f, TunnelClearance + 25.f), FVector(100.f, 300.f, 25.f));
+	ParkourTestFixture::SpawnBox(World, FVector(FarFloorStart + 1250.f, 0.f, -50.f), FVector(1250.f, 300.f, 50.f));
+
+	NavSys->Build();
+
+	AParkourNavLinkProxy* Proxy = World->SpawnActor<AParkourNavLinkProxy>(AParkourNavLinkProxy::StaticClass(), FTransform::Identity);
+	Proxy->LinkData = NewObject<UParkourNavLinkData>(Proxy);
+	Proxy->Tuning = CharacterDefaults->Tuning;
+	Proxy->CharacterClass = CharacterClass;
+	Proxy->BuildLinks();
+
+	// Links Take Effect Once the Nav Mesh is Rebuilt Around Them
+	NavSys->Build();
+
+	int32 NumLinks[2] = {};
+	for (const FParkourNavLink& Link : Proxy->LinkData->Links)
+	{
+		++NumLinks[static_cast<int32>(Link.Type)];
+	}
+	TestTrue(TEXT("Crouch tunnel links"), NumLinks[static_cast<int32>(EParkourNavLink::EPNL_CrouchTunnel)] > 0);
+	TestTrue(TEXT("Double jump links"), NumLinks[static_cast<int32>(EParkourNavLink::EPNL_DoubleJump)] > 0);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	const FVector Start(-300.f, 0.f, StandingHalfHeight + 2.f);
+	const FVector Goal(FarFloorStart + 600.f, 0.f, 0.f);
+	AParkourSystemCharacter* Character = ParkourTestFixture::SpawnCharacter(World, Start);
+	AParkourBotController* Bot = World->SpawnActor<AParkourBotController>(AParkourBotController::StaticClass(), FTransform(Start), SpawnParams);
+	if (!TestNotNull(TEXT("Character"), Character) || !TestNotNull(TEXT("Bot"), Bot))
+	{
+		ParkourTestFixture::DestroyWorld(World);
+		return false;
+	}
+
+	// Empty Route, so that Only Path Following Drives the Character
+	Bot->Route = NewObject<UParkourRoute>(Bot);
+	Bot->Possess(Character);
+
+	const EPathFollowingRequestResult::Type Request = Bot->MoveToLocation(Goal, 50.f, true, true, true, false);
+	TestEqual(TEXT("Move request"), static_cast<int32>(Request), static_cast<int32>(EPathFollowingRequestResult::RequestSuccessful));
+
+	constexpr float DeltaSeconds = 1.f / 60.f;
+	bool bCrouched = false;
+	bool bDoubleJumped = false;
+	for (int32 Frame = 0; Frame < 1200 && Bot->GetMoveStatus() != EPathFollowingStatus::Idle; ++Frame)
+	{
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+		++GFrameCounter;
+
+		bCrouched |= Character->GetParkourMode() == EParkourMode::EPM_Crouch;
+		bDoubleJumped |= Character->GetCharacterMovement()->IsFalling() && !Character->GetParkourState().bCanDoubleJump;
+	}
+
+	const FVector End = Character->GetActorLocation();
+	TestTrue(TEXT("Crouched through the tunnel"), bCrouched);
+	TestTrue(TEXT("Double jumped over the gap"), bDoubleJumped);
+	TestTrue(FString::Printf(TEXT("Reached the goal, ended at %s"), *End.ToString()), FVector::Dist2D(End, Goal) <= 100.f && End.Z > 0.f);
+
+	ParkourTestFixture::DestroyWorld(World);
+	return true;
+}
+#endif
+
+namespace ParkourSystemTests
+{
+	// Fixed Step of the Trajectory Test, and How Long a Jump May Take to Land
+	constexpr float TrajectoryDeltaTime = 1.f / 120.f;
+	constexpr int32 MaxTrajectoryFrames = 600;
+
+	// Landing Happens Within a Frame, and the Capsule Falls Through Its Floor Distance Before Touching Down
+	constexpr float LandingSlackTime = TrajectoryDeltaTime + 0.01f;
+
+	// Arc a Character Actually Flew, Sampled Once per Frame
+	struct FSimulatedArc
+	{
+		float ApexZ = -UE_BIG_NUMBER;
+		FVector Landing = FVector::ZeroVector;
+		float LandingTime = -1.f;
+	};
+
+	// Character Standing Still on the Floor, Simulated Without a Controller
+	static AParkourSystemCharacter* SpawnStandingCharacter(UWorld* World)
+	{
+		AParkourSystemCharacter* Character = ParkourTestFixture::SpawnCharacter(World, FVector(0.f, 0.f, 110.f));
+		if (Character == nullptr)
+		{
+			return nullptr;
+		}
+
+		Character->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+		for (int32 Frame = 0; Frame < 60; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, TrajectoryDeltaTime);
+		}
+
+		return Character;
+	}
+
+	// Tick the World Until the Character Lands, Releasing Jump After the Launch Frame
+	static FSimulatedArc FlyUntilLanded(UWorld* World, AParkourSystemCharacter& Character)
+	{
+		FSimulatedArc Arc;
+		for (int32 Frame = 1; Frame <= MaxTrajectoryFrames; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, TrajectoryDeltaTime);
+			if (Frame == 1)
+			{
+				Character.StopJumping();
+			}
+
+			const FVector Location = Character.GetActorLocation();
+			Arc.ApexZ = FMath::Max(Arc.ApexZ, Location.Z);
+
+			if (!Character.GetCharacterMovement()->IsFalling())
+			{
+				Arc.Landing = Location;
+				Arc.LandingTime = Frame * TrajectoryDeltaTime;
+				break;
+			}
+		}
+
+		return Arc;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParkourTrajectoryTest, "Parkour.Trajectory", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// Jumps Simulated by the Movement Component Fly the Arcs FParkourTrajectorySolver Predicts
+bool FParkourTrajectoryTest::RunTest(const FString& Parameters)
+{
+	using namespace ParkourSystemTests;
+
+	UWorld* World = ParkourTestFixture::CreateWorld(TEXT("ParkourTrajectoryTest"));
+	ParkourTestFixture::SpawnBox(World, FVector(0.f, 0.f, -50.f), FVector(20000.f, 20000.f, 50.f));
+
+	// Compare a Flown Arc with the Prediction from Its Launch, Landing Back on the Floor the Jump Started from
+	auto CheckArc = [this](const TCHAR* Name, const FVector& Start, const FVector& LaunchVelocity, float GravityZ, float FloorZ, const FSimulatedArc& Arc, bool bCheckReachability)
+	{
+		if (!TestTrue(FString::Printf(TEXT("%s lands"), Name), Arc.LandingTime > 0.f))
+		{
+			return;
+		}
+
+		const float PredictedApexZ = Start.Z + FMath::Square(FMath::Max(LaunchVelocity.Z, 0.f)) / (-2.f * GravityZ);
+		TestEqual(FString::Printf(TEXT("%s apex height"), Name), Arc.ApexZ, PredictedApexZ, 1.f);
+
+		FVector PredictedLanding;
+		float PredictedTime = 0.f;
+		if (!TestTrue(FString::Printf(TEXT("%s has a predicted landing"), Name), FParkourTrajectorySolver::PredictLanding(Start, LaunchVelocity, GravityZ, FloorZ, PredictedLanding, PredictedTime)))
+		{
+			return;
+		}
+
+		const float LandingRadius = LaunchVelocity.Size2D() * LandingSlackTime + 1.f;
+		TestTrue(FString::Printf(TEXT("%s lands at %.3f s, predicted %.3f s"), Name, Arc.LandingTime, PredictedTime), FMath::Abs(Arc.LandingTime - PredictedTime) <= LandingSlackTime);
+		TestTrue(FString::Printf(TEXT("%s lands at %s, predicted %s"), Name, *Arc.Landing.ToString(), *PredictedLanding.ToString()), FVector::Dist2D(Arc.Landing, PredictedLanding) <= LandingRadius);
+		TestEqual(FString::Printf(TEXT("%s landing height"), Name), Arc.Landing.Z, FloorZ, 3.f);
+
+		if (bCheckReachability)
+		{
+			// The Spot Actually Landed on Counts as Reachable, at About the Time It was Reached
+			const FVector Target(Arc.Landing.X, Arc.Landing.Y, FloorZ);
+			float ReachTime = -1.f;
+			FParkourTrajectorySolver::SolveReachability(Start, LaunchVelocity, FVector::ForwardVector, GravityZ, false, LandingRadius, *GetDefault<UParkourTuning>(), MakeArrayView(&Target, 1), MakeArrayView(&ReachTime, 1));
+			TestTrue(FString::Printf(TEXT("%s landing reachable at %.3f s"), Name, ReachTime), ReachTime >= 0.f && FMath::Abs(Arc.LandingTime - ReachTime) <= LandingSlackTime);
+		}
+	};
+
+	// Standing Jump
+	if (AParkourSystemCharacter* Character = SpawnStandingCharacter(World))
+	{
+		UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
+		const FVector Start = Character->GetActorLocation();
+		const FVector LaunchVelocity = FParkourTrajectorySolver::GroundJumpVelocity(MovementComponent->Velocity, Character->GetActorForwardVector(), MovementComponent->JumpZVelocity, 0.f);
+
+		Character->Jump();
+		CheckArc(TEXT("Standing jump"), Start, LaunchVelocity, MovementComponent->GetGravityZ(), Start.Z, FlyUntilLanded(World, *Character), true);
+
+		Character->Destroy();
+	}
+
+	// Sprint Jump, Carrying Momentum
+	if (AParkourSystemCharacter* Character = SpawnStandingCharacter(World))
+	{
+		UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
+		ParkourTestFixture::HoldForward(*Character);
+		Character->Sprint();
+		MovementComponent->Velocity = Character->GetActorForwardVector() * 600.f;
+
+		const FVector Start = Character->GetActorLocation();
+		const float CarriedSpeed = FParkourTrajectorySolver::CarriedSpeed(MovementComponent->Velocity.Size2D(), Character->GetTuning().SprintJumpForce, Character->GetTuning());
+		const FVector LaunchVelocity = FParkourTrajectorySolver::GroundJumpVelocity(MovementComponent->Velocity, Character->GetActorForwardVector(), MovementComponent->JumpZVelocity, CarriedSpeed);
+
+		Character->Jump();
+		CheckArc(TEXT("Sprint jump"), Start, LaunchVelocity, MovementComponent->GetGravityZ(), Start.Z, FlyUntilLanded(World, *Character), true);
+
+		Character->Destroy();
+	}
+
+	// Double Jump While Still Rising
+	if (AParkourSystemCharacter* Character = SpawnStandingCharacter(World))
+	{
+		UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
+		const float FloorZ = Character->GetActorLocation().Z;
+
+		Character->Jump();
+		for (int32 Frame = 0; Frame < 20; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, TrajectoryDeltaTime);
+			Character->StopJumping();
+		}
+
+		const FVector Start = Character->GetActorLocation();
+		const FVector LaunchVelocity = FParkourTrajectorySolver::DoubleJumpVelocity(MovementComponent->Velocity, Character->GetActorForwardVector(), Character->GetTuning());
+
+		Character->Jump();
+		CheckArc(TEXT("Double jump"), Start, LaunchVelocity, MovementComponent->GetGravityZ(), FloorZ, FlyUntilLanded(World, *Character), false);
+
+		Character->Destroy();
+	}
+
+	// Double Jump Well into the Fall, Reachable from the Moment the Fall Began
+	if (AParkourSystemCharacter* Character = SpawnStandingCharacter(World))
+	{
+		UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
+		const UParkourTuning& CharacterTuning = Character->GetTuning();
+		const float FloorZ = Character->GetActorLocation().Z;
+		const float GravityZ = MovementComponent->GetGravityZ();
+
+		Character->Jump();
+		for (int32 Frame = 0; Frame < MaxTrajectoryFrames && MovementComponent->Velocity.Z >= 0.f; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, TrajectoryDeltaTime);
+			Character->StopJumping();
+		}
+
+		const FVector FallStart = Character->GetActorLocation();
+		const FVector FallVelocity = MovementComponent->Velocity;
+
+		// Double Jump at One of the Times the Solver Tries, Rounded to a Frame
+		constexpr int32 DoubleJumpIndex = 2;
+		const float LatestTime = FParkourTrajectorySolver::LatestDoubleJumpTime(FallStart.Z, FallVelocity.Z, GravityZ, FloorZ, CharacterTuning);
+		const float DoubleJumpTime = LatestTime * DoubleJumpIndex / (FParkourTrajectorySolver::NumDoubleJumpTimes - 1);
+		const int32 NumFallFrames = FMath::RoundToInt(DoubleJumpTime / TrajectoryDeltaTime);
+		for (int32 Frame = 0; Frame < NumFallFrames; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, TrajectoryDeltaTime);
+		}
+
+		if (TestTrue(TEXT("Still falling before the late double jump"), MovementComponent->IsFalling() && NumFallFrames > 0))
+		{
+			const FVector Start = Character->GetActorLocation();
+			const FVector LaunchVelocity = FParkourTrajectorySolver::DoubleJumpVelocity(MovementComponent->Velocity, Character->GetActorForwardVector(), CharacterTuning);
+
+			Character->Jump();
+			const FSimulatedArc Arc = FlyUntilLanded(World, *Character);
+			CheckArc(TEXT("Late double jump"), Start, LaunchVelocity, GravityZ, FloorZ, Arc, false);
+
+			// Rounding the Double Jump to a Frame Moves the Landing by About Another Frame of Travel
+			const FVector Target(Arc.Landing.X, Arc.Landing.Y, FloorZ);
+			const float ReachRadius = 2.f * LaunchVelocity.Size2D() * LandingSlackTime + 1.f;
+			const float LandingTime = NumFallFrames * TrajectoryDeltaTime + Arc.LandingTime;
+
+			float ReachTime = -1.f;
+			FParkourTrajectorySolver::SolveReachability(FallStart, FallVelocity, Character->GetActorForwardVector(), GravityZ, true, ReachRadius, CharacterTuning, MakeArrayView(&Target, 1), MakeArrayView(&ReachTime, 1));
+			TestTrue(FString::Printf(TEXT("Late double jump landing reachable while falling at %.3f s, landed at %.3f s"), ReachTime, LandingTime), ReachTime >= 0.f && FMath::Abs(LandingTime - ReachTime) <= 2.f * LandingSlackTime);
+		}
+
+		Character->Destroy();
+	}
+
+	// Batch Reachability Cost
+	const UParkourTuning& Tuning = *GetDefault<UParkourTuning>();
+	const FVector Velocity(600.f, 0.f, 420.f);
+
+	constexpr int32 NumTargets = 10000;
+	TArray<FVector> Targets;
+	TArray<float> Times;
+	Targets.SetNumUninitialized(NumTargets);
+	Times.SetNumUninitialized(NumTargets);
+
+	FRandomStream Stream(NumTargets);
+	for (FVector& Target : Targets)
+	{
+		Target = FVector(Stream.FRandRange(0.f, 2000.f), Stream.FRandRange(-200.f, 200.f), Stream.FRandRange(-300.f, 300.f));
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	FParkourTrajectorySolver::SolveReachability(FVector::ZeroVector, Velocity, FVector::ForwardVector, World->GetGravityZ(), true, 50.f, Tuning, Targets, Times);
+	AddInfo(FString::Printf(TEXT("Batch reachability: %.2f ns/target"), (FPlatformTime::Seconds() - StartSeconds) * 1e9 / NumTargets));
+
+	ParkourTestFixture::DestroyWorld(World);
+	return true;
+}
+
+namespace ParkourSystemTests
+{
+	constexpr int32 ReplayKeyframeInterval = 10;
+	constexpr float ReplaySampleRate = 30.f;
+
+	// Sample Where the Character Teleports Further than a Delta can Hold, Not Followed by a Keyframe
+	constexpr int32 ReplayTeleportIndex = 45;
+
+	// Samples Moving a Few Centimetres per Sample, Except for One Teleport
+	static TArray<FParkourReplaySample> MakeReplaySamples(int32 NumSamples)
+	{
+		TArray<FParkourReplaySample> Samples;
+		Samples.SetNum(NumSamples);
+
+		FRandomStream Stream(NumSamples);
+		FVector Location(1000.25f, -2000.5f, 300.f);
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			const FVector Velocity = Stream.GetUnitVector() * Stream.FRandRange(0.f, 800.f);
+			Location += Velocity / ReplaySampleRate;
+			if (Index == ReplayTeleportIndex)
+			{
+				Location.X += 5000.f;
+			}
+
+			Samples[Index].Location = Location;
+			Samples[Index].Velocity = Velocity;
+			Samples[Index].CapsuleHalfHeight = Stream.FRandRange(40.f, 96.f);
+			Samples[Index].Mode = static_cast<EParkourMode>(Index % (static_cast<int32>(EParkourMode::EPM_Slide) + 1));
+		}
+
+		return Samples;
+	}
+
+	// Decode Every Record in File Order, Without the Reader's Random Access
+	static TArray<FParkourReplaySample> DecodeReplaySequentially(const TArray<uint8>& Bytes)
+	{
+		TArray<FParkourReplaySample> Samples;
+
+		ParkourReplay::FHeader Header;
+		FMemory::Memcpy(&Header, Bytes.GetData(), sizeof(Header));
+
+		FVector Location = FVector::ZeroVector;
+		int64 Offset = sizeof(Header);
+		for (int32 Index = 0; ; ++Index)
+		{
+			FParkourReplaySample& Sample = Samples.AddDefaulted_GetRef();
+			if (Index % Header.KeyframeInterval == 0 && Offset + static_cast<int64>(sizeof(ParkourReplay::FKeyframe)) <= Bytes.Num())
+			{
+				ParkourReplay::FKeyframe Keyframe;
+				FMemory::Memcpy(&Keyframe, Bytes.GetData() + Offset, sizeof(Keyframe));
+				Offset += sizeof(Keyframe);
+
+				Location = FVector(Keyframe.Location[0], Keyframe.Location[1], Keyframe.Location[2]);
+				Sample.Velocity = FVector(Keyframe.Velocity[0], Keyframe.Velocity[1], Keyframe.Velocity[2]);
+				Sample.CapsuleHalfHeight = Keyframe.CapsuleHalfHeight / ParkourReplay::HalfHeightScale;
+				Sample.Mode = static_cast<EParkourMode>(Keyframe.Mode);
+			}
+			else if (Index % Header.KeyframeInterval != 0 && Offset + static_cast<int64>(sizeof(ParkourReplay::FDelta)) <= Bytes.Num())
+			{
+				ParkourReplay::FDelta Delta;
+				FMemory::Memcpy(&Delta, Bytes.GetData() + Offset, sizeof(Delta));
+				Offset += sizeof(Delta);
+
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					Location[Axis] += Delta.LocationDelta[Axis] / ParkourReplay::LocationScale;
+				}
+				Sample.Velocity = FVector(Delta.Velocity[0], Delta.Velocity[1], Delta.Velocity[2]);
+				Sample.CapsuleHalfHeight = Delta.CapsuleHalfHeight / ParkourReplay::HalfHeightScale;
+				Sample.Mode = static_cast<EParkourMode>(Delta.Mode);
+			}
+			else
+			{
+				Samples.Pop();
+				break;
+			}
+
+			Sample.Location = Location;
+		}
+
+		return Samples;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParkourReplayCodecTest, "Parkour.ReplayCodec", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// Replay Files Decode Within Their Quantization, Randomly as Sequentially, and Survive Being Cut Short
+bool FParkourReplayCodecTest::RunTest(const FString& Parameters)
+{
+	using namespace ParkourSystemTests;
+
+	// Several Whole Blocks and a Partial One
+	constexpr int32 NumSamples = 5 * ReplayKeyframeInterval + 5;
+	const TArray<FParkourReplaySample> Samples = MakeReplaySamples(NumSamples);
+
+	const FString Filename = FPaths::AutomationTransientDir() / TEXT("ParkourReplayCodecTest.pkreplay");
+	const FString TruncatedFilename = FPaths::AutomationTransientDir() / TEXT("ParkourReplayCodecTest_Truncated.pkreplay");
+
+	{
+		FParkourReplayWriter Writer;
+		if (!TestTrue(TEXT("Writer opens"), Writer.Open(Filename, ReplaySampleRate, ReplayKeyframeInterval, 12.5)))
+		{
+			return false;
+		}
+
+		for (const FParkourReplaySample& Sample : Samples)
+		{
+			Writer.Append(Sample);
+		}
+	}
+
+	FParkourReplayReader Reader;
+	if (!TestTrue(TEXT("Reader opens"), Reader.Open(Filename)))
+	{
+		return false;
+	}
+
+	TestEqual(TEXT("Sample count"), Reader.GetNumSamples(), NumSamples);
+	TestEqual(TEXT("Start time"), Reader.GetStartTime(), 12.5);
+
+	// Half a Quantization Step, Plus Float Precision of Keyframe Locations
+	const float LocationBound = 0.5f / ParkourReplay::LocationScale + 0.001f;
+	const float HalfHeightBound = 0.5f / ParkourReplay::HalfHeightScale + UE_KINDA_SMALL_NUMBER;
+
+	TArray<FParkourReplaySample> Decoded;
+	Decoded.SetNum(NumSamples);
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		if (!TestTrue(FString::Printf(TEXT("Sample %d decodes"), Index), Reader.GetSample(Index, Decoded[Index])))
+		{
+			return false;
+		}
+
+		const FParkourReplaySample& Sample = Samples[Index];
+		const float LocationError = (Decoded[Index].Location - Sample.Location).GetAbsMax();
+
+		// The Teleport is Clamped to What a Delta can Hold, the Next Delta Catches up
+		if (Index == ReplayTeleportIndex)
+		{
+			TestTrue(FString::Printf(TEXT("Teleport clamped, %.1f cm behind"), LocationError), LocationError > LocationBound);
+		}
+		else
+		{
+			TestTrue(FString::Printf(TEXT("Sample %d location within %.3f cm, off by %.4f cm"), Index, LocationBound, LocationError), LocationError <= LocationBound);
+		}
+
+		TestTrue(FString::Printf(TEXT("Sample %d velocity within 0.5 cm/s"), Index), (Decoded[Index].Velocity - Sample.Velocity).GetAbsMax() <= 0.5f + UE_KINDA_SMALL_NUMBER);
+		TestTrue(FString::Printf(TEXT("Sample %d half height within %.3f cm"), Index, HalfHeightBound), FMath::Abs(Decoded[Index].CapsuleHalfHeight - Sample.CapsuleHalfHeight) <= HalfHeightBound);
+		TestEqual(FString::Printf(TEXT("Sample %d mode"), Index), static_cast<int32>(Decoded[Index].Mode), static_cast<int32>(Sample.Mode));
+	}
+
+	// Random Access Decodes Exactly What Reading the File in Order Does
+	TArray<uint8> Bytes;
+	if (!TestTrue(TEXT("File loads"), FFileHelper::LoadFileToArray(Bytes, *Filename)))
+	{
+		return false;
+	}
+
+	const TArray<FParkourReplaySample> Sequential = DecodeReplaySequentially(Bytes);
+	if (TestEqual(TEXT("Sequential sample count"), Sequential.Num(), NumSamples))
+	{
+		for (int32 Index = 0; Index < NumSamples; ++Index)
+		{
+			TestTrue(FString::Printf(TEXT("Sample %d random access matches sequential decode"), Index),
+				Decoded[Index].Location.Equals(Sequential[Index].Location, 1e-6)
+				&& Decoded[Index].Velocity == Sequential[Index].Velocity
+				&& Decoded[Index].CapsuleHalfHeight == Sequential[Index].CapsuleHalfHeight
+				&& Decoded[Index].Mode == Sequential[Index].Mode);
+		}
+	}
+
+	Reader.Close();
+
+	// Cut Partway Through a Delta, as a Crash While Writing would Leave It
+	constexpr int32 NumWholeSamples = 2 * ReplayKeyframeInterval + 4;
+	const int64 TruncatedSize = sizeof(ParkourReplay::FHeader)
+		+ 2 * ParkourReplay::GetBlockSize(ReplayKeyframeInterval)
+		+ sizeof(ParkourReplay::FKeyframe)
+		+ 3 * sizeof(ParkourReplay::FDelta)
+		+ sizeof(ParkourReplay::FDelta) / 2;
+
+	Bytes.SetNum(static_cast<int32>(TruncatedSize));
+	if (TestTrue(TEXT("Truncated file saves"), FFileHelper::SaveArrayToFile(Bytes, *TruncatedFilename)) && TestTrue(TEXT("Truncated file opens"), Reader.Open(TruncatedFilename)))
+	{
+		TestEqual(TEXT("Truncated file plays to its last whole record"), Reader.GetNumSamples(), NumWholeSamples);
+
+		FParkourReplaySample Last;
+		TestTrue(TEXT("Last whole record decodes"), Reader.GetSample(NumWholeSamples - 1, Last) && Last.Location == Decoded[NumWholeSamples - 1].Location);
+		TestFalse(TEXT("Partial record is not decoded"), Reader.GetSample(NumWholeSamples, Last));
+
+		Reader.Close();
+	}
+
+	IFileManager::Get().Delete(*Filename);
+	IFileManager::Get().Delete(*TruncatedFilename);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParkourProjectileTunnelingTest, "Parkour.ProjectileTunneling", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// Projectiles Never Pass Through Any Part of a Thin Wall at Any Tick Rate, and the Broadphase Saves Sweeps
+bool FParkourProjectileTunnelingTest::RunTest(const FString& Parameters)
+{
+	IConsoleVariable* BroadphaseCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("parkour.ProjectileBroadphase"));
+	if (!TestNotNull(TEXT("parkour.ProjectileBroadphase"), BroadphaseCVar))
+	{
+		return false;
+	}
+
+	constexpr int32 NumShots = 32;
+	const bool bPrevBroadphase = BroadphaseCVar->GetBool();
+
+	UWorld* World = ParkourTestFixture::CreateWorld(TEXT("ParkourProjectileTunnelingTest"));
+
+	// Wall 2 Units Thick, Thinner than the Distance a Projectile Moves in a Frame at Any Tick Rate
+	const FVector Origin = ParkourTestFixture::FarLocation;
+	const FVector WallLocation = Origin + FVector(1000.f, 0.f, 0.f);
+	const FVector WallHalfSize(1.f, 400.f, 400.f);
+	ParkourTestFixture::SpawnBox(World, WallLocation, WallHalfSize);
+
+	// A Center Passing Within Half the Collision Radius of the Wall Means the Sphere Went Through Part of It
+	const float Radius = GetDefault<AParkourSystemProjectile>()->GetCollisionComp()->GetScaledSphereRadius();
+	const FBox PenetrationBox = FBox::BuildAABB(WallLocation, WallHalfSize + FVector(0.5f * Radius));
+
+	// Shots at the Wall and into Open Air
+	TArray<FVector> Targets;
+	FRandomStream Stream(NumShots);
+	for (int32 Shot = 0; Shot < NumShots; ++Shot)
+	{
+		Targets.Add(WallLocation + FVector(0.f, Stream.FRandRange(-300.f, 300.f), Stream.FRandRange(-300.f, 300.f)));
+		Targets.Add(Origin - FVector(1000.f, Stream.FRandRange(-300.f, 300.f), Stream.FRandRange(-300.f, 300.f)));
+	}
+
+	// Shots Just Inside the Side Edges, and Near Misses Whose Centers Pass Outside but Whose Spheres Graze the Edge
+	for (const float Side : { -1.f, 1.f })
+	{
+		for (const float EdgeOffset : { -0.5f * Radius, 0.3f * Radius, 0.8f * Radius })
+		{
+			for (const float Height : { -200.f, 0.f, 200.f })
+			{
+				Targets.Add(WallLocation + FVector(0.f, Side * (WallHalfSize.Y + EdgeOffset), Height));
+			}
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	for (const float TickRate : { 10.f, 30.f, 60.f, 120.f })
+	{
+		const float DeltaTime = 1.f / TickRate;
+		double SweepsPerShot[2] = {};
+
+		for (const bool bBroadphase : { false, true })
+		{
+			BroadphaseCVar->Set(bBroadphase, ECVF_SetByConsole);
+			UParkourProjectileMovementComponent::ResetQueryStats();
+
+			int32 NumTunneled = 0;
+			for (const FVector& Target : Targets)
+			{
+				AParkourSystemProjectile* Projectile = World->SpawnActor<AParkourSystemProjectile>(AParkourSystemProjectile::StaticClass(), Origin, (Target - Origin).Rotation(), SpawnParams);
+				if (!TestNotNull(TEXT("Projectile"), Projectile))
+				{
+					continue;
+				}
+
+				// Stepped Here Only, at the Tick Rate Under Test
+				UProjectileMovementComponent* Movement = Projectile->GetProjectileMovement();
+				Movement->SetComponentTickEnabled(false);
+
+				FVector PreviousLocation = Projectile->GetActorLocation();
+				for (float Time = 0.f; Time < 1.f; Time += DeltaTime)
+				{
+					Movement->TickComponent(DeltaTime, LEVELTICK_All, &Movement->PrimaryComponentTick);
+
+					const FVector Location = Projectile->GetActorLocation();
+					if (FMath::LineBoxIntersection(PenetrationBox, PreviousLocation, Location, Location - PreviousLocation))
+					{
+						++NumTunneled;
+						break;
+					}
+					PreviousLocation = Location;
+				}
+
+				Projectile->Destroy();
+			}
+
+			const FParkourProjectileQueryStats& Stats = UParkourProjectileMovementComponent::GetQueryStats();
+			SweepsPerShot[bBroadphase] = static_cast<double>(Stats.NumSweeps) / Targets.Num();
+
+			TestEqual(FString::Printf(TEXT("Tunneled shots at %.0f Hz, broadphase %s"), TickRate, bBroadphase ? TEXT("on") : TEXT("off")), NumTunneled, 0);
+			AddInfo(FString::Printf(TEXT("%.0f Hz, broadphase %s: %.1f sweeps and %.1f overlaps per shot"),
+				TickRate,
+				bBroadphase ? TEXT("on") : TEXT("off"),
+				SweepsPerShot[bBroadphase],
+				static_cast<double>(Stats.NumOverlaps) / Targets.Num()));
+		}
+
+		TestTrue(FString::Printf(TEXT("Broadphase reduces sweeps per shot at %.0f Hz (%.1f to %.1f)"), TickRate, SweepsPerShot[0], SweepsPerShot[1]), SweepsPerShot[1] < SweepsPerShot[0]);
+	}
+
+	BroadphaseCVar->Set(bPrevBroadphase, ECVF_SetByConsole);
+	ParkourTestFixture::DestroyWorld(World);
+	return true;
+}
+
+#endif
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourTestFixture.h"
+#include "ParkourSystemCharacter.h"
+#include "ParkourTuning.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace ParkourTestFixture
+{
+	// Prefer the Blueprinted Character, so that Its Defaults are Used
+	UClass* GetCharacterClass(const UWorld* World)
+	{
+		if (const AGameModeBase* GameMode = World->GetAuthGameMode())
+		{
+			if (GameMode->DefaultPawnClass && GameMode->DefaultPawnClass->IsChildOf(AParkourSystemCharacter::StaticClass()))
+			{
+				return GameMode->DefaultPawnClass;
+			}
+		}
+
+		return AParkourSystemCharacter::StaticClass();
+	}
+
+	AParkourSystemCharacter* SpawnCharacter(UWorld* World, const FVector& Location)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		return World->SpawnActor<AParkourSystemCharacter>(GetCharacterClass(World), Location, FRotator::ZeroRotator, SpawnParams);
+	}
+
+	void HoldForward(AParkourSystemCharacter& Character)
+	{
+		Character.AddMovementInput(Character.GetActorForwardVector(), 1.f);
+		Character.ConsumeMovementInputVector();
+	}
+
+	// The Engine Cube is 100 Units Across
+	AStaticMeshActor* SpawnBox(UWorld* World, const FVector& Center, const FVector& HalfExtent)
+	{
+		const FTransform Transform(FRotator::ZeroRotator, Center, HalfExtent / 50.f);
+
+		AStaticMeshActor* Box = World->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform);
+		Box->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Box->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+		Box->FinishSpawning(Transform);
+
+		return Box;
+	}
+
+	UWorld* CreateWorld(const TCHAR* Name)
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, Name);
+		World->AddToRoot();
+
+		StartWorld(World);
+
+		return World;
+	}
+
+	void StartWorld(UWorld* World)
+	{
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->UpdateWorldComponents(true, false);
+
+		const FURL URL;
+		World->SetGameMode(URL);
+		World->InitializeActorsForPlay(URL);
+		World->BeginPlay();
+	}
+
+	void DestroyWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+	}
+
+	FVector LegacySlideStep(const FVector& Velocity, const FVector& FloorNormal, const UParkourTuning& Tuning, FVector& OutForce, bool& bOutShouldEnd)
+	{
+		bOutShouldEnd = Velocity.Length() < Tuning.SlideStopSpeed;
+
+		const FVector ForceDirection = FVector::CrossProduct(FloorNormal, FVector::CrossProduct(FloorNormal, FVector::UpVector)).GetSafeNormal();
+		OutForce = ForceDirection * Tuning.SlideSpeed * Tuning.SlideForceMultiplier;
+
+		FVector Result = Velocity;
+		if (Velocity.Length() > Tuning.SlideSpeed)
+		{
+			Result = Tuning.SlideSpeed * Velocity.GetSafeNormal();
+		}
+
+		return Result;
+	}
+}
+
+#endif
@@ -0,0 +1,48 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+class AParkourSystemCharacter;
+class AStaticMeshActor;
+class UParkourTuning;
+class UWorld;
+
+/**
+ * Setup shared by automation tests, benchmark commands and commandlets that run parkour characters headless.
+ * Compiled out of Shipping builds, like everything that uses it.
+ */
+namespace ParkourTestFixture
+{
+	// Far Above Level Geometry, where Spawned Characters Fall Freely
+	inline const FVector FarLocation(0.f, 0.f, 100000.f);
+
+	// Character Class to Spawn, the Game Mode's Blueprinted Character If It Has One
+	UClass* GetCharacterClass(const UWorld* World);
+
+	// Spawn a Character Regardless of Collision, Far from Level Geometry by Default
+	AParkourSystemCharacter* SpawnCharacter(UWorld* World, const FVector& Location = FarLocation);
+
+	// Hold Forward Input, as ForwardInput() Reads the Last Consumed Input Vector
+	void HoldForward(AParkourSystemCharacter& Character);
+
+	// Spawn a Box Made of the Engine Cube
+	AStaticMeshActor* SpawnBox(UWorld* World, const FVector& Center, const FVector& HalfExtent);
+
+	// Create an Empty Game World and Start It
+	UWorld* CreateWorld(const TCHAR* Name);
+
+	// Give a World a Context, Its Game Mode and Begin Play
+	void StartWorld(UWorld* World);
+
+	// Tear Down a World Started by StartWorld()
+	void DestroyWorld(UWorld* World);
+
+	// Slide Step as Written Before FParkourSlideKernel, Kept as Baseline
+	FVector LegacySlideStep(const FVector& Velocity, const FVector& FloorNormal, const UParkourTuning& Tuning, FVector& OutForce, bool& bOutShouldEnd);
+}
+
+#endif
@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourTuning.h"
+
+/**
+ * Closed-form jump arcs of AParkourSystemCharacter, for AI reachability queries and jump previews.
+ * Jump() launches through the same functions, so predicted and actual launch velocities always match.
+ * Air control and drag are not modelled.
+ */
+struct FParkourTrajectorySolver
+{
+	// Launch Options Tried per Target, Without Double Jump Then Double Jumping at Evenly Spaced Times, the First Now and the Last at LatestDoubleJumpTime()
+	static constexpr int32 NumDoubleJumpTimes = 8;
+
+	// Horizontal Speed Carried by a Momentum Link, as FParkourMomentum::AddLink Computes It
+	static FORCEINLINE float CarriedSpeed(float HorizontalSpeed, float BonusSpeed, const UParkourTuning& Tuning)
+	{
+		return FMath::Min(HorizontalSpeed * Tuning.MomentumCarryRatio + BonusSpeed, Tuning.MomentumSpeedBudget);
+	}
+
+	// If a Ground Jump Carrying Speed Launches the Character, Rather than Jumping Normally
+	static FORCEINLINE bool ShouldThrust(const FVector& Velocity, float CarriedSpeed)
+	{
+		return CarriedSpeed > 0.f && Velocity.SizeSquared2D() < FMath::Square(CarriedSpeed);
+	}
+
+	// Velocity Right After Jumping from the Ground
+	//! A pending launch replaces the whole velocity, so it carries the jump's Z velocity too
+	static FORCEINLINE FVector GroundJumpVelocity(const FVector& Velocity, const FVector& Forward, float JumpZVelocity, float CarriedSpeed)
+	{
+		FVector Result = Velocity;
+
+		if (ShouldThrust(Velocity, CarriedSpeed))
+		{
+			FVector ThrustDirection = Velocity.GetSafeNormal2D();
+			if (ThrustDirection.IsZero())
+			{
+				ThrustDirection = Forward.GetSafeNormal2D();
+			}
+
+			Result.X = ThrustDirection.X * CarriedSpeed;
+			Result.Y = ThrustDirection.Y * CarriedSpeed;
+		}
+
+		Result.Z = FMath::Max(Velocity.Z, JumpZVelocity);
+		return Result;
+	}
+
+	// Velocity Right After Double Jumping, Horizontal Force is Added and Vertical Force Replaces Z
+	static FORCEINLINE FVector DoubleJumpVelocity(const FVector& Velocity, const FVector& Forward, const UParkourTuning& Tuning)
+	{
+		return FVector(
+			Velocity.X + Forward.X * Tuning.HorizontalJumpForce,
+			Velocity.Y + Forward.Y * Tuning.HorizontalJumpForce,
+			Tuning.VerticalJumpForce);
+	}
+
+	// Location Along an Arc, GravityZ is Negative
+	static FORCEINLINE FVector Evaluate(const FVector& Location, const FVector& Velocity, float GravityZ, float Time)
+	{
+		return Location + Velocity * Time + FVector(0.f, 0.f, 0.5f * GravityZ * Time * Time);
+	}
+
+	// Time an Arc Falls Through Height Z, Negative If It Never Does
+	static FORCEINLINE float FallTimeToHeight(float StartZ, float VelocityZ, float GravityZ, float Z)
+	{
+		// StartZ + VelocityZ * t + GravityZ * t^2 / 2 = Z, Later Root
+		const float Discriminant = VelocityZ * VelocityZ - 2.f * GravityZ * (StartZ - Z);
+		if (Discriminant < 0.f || GravityZ >= 0.f)
+		{
+			return -1.f;
+		}
+
+		return (-VelocityZ - FMath::Sqrt(Discriminant)) / GravityZ;
+	}
+
+	// Last Time Along an Arc a Double Jump Can Still Rise to Height TargetZ, Negative If None Can
+	static FORCEINLINE float LatestDoubleJumpTime(float StartZ, float VelocityZ, float GravityZ, float TargetZ, const UParkourTuning& Tuning)
+	{
+		// Highest a Double Jump Rises Above the Point It Starts from
+		const float Rise = FMath::Square(FMath::Max(Tuning.VerticalJumpForce, 0.f)) / (-2.f * GravityZ);
+		return FallTimeToHeight(StartZ, VelocityZ, GravityZ, TargetZ - Rise);
+	}
+
+	// Where an Arc Lands on a Floor at Height FloorZ
+	static FORCEINLINE bool PredictLanding(const FVector& Location, const FVector& Velocity, float GravityZ, float FloorZ, FVector& OutLanding, float& OutTime)
+	{
+		OutTime = FallTimeToHeight(Location.Z, Velocity.Z, GravityZ, FloorZ);
+		if (OutTime < 0.f)
+		{
+			return false;
+		}
+
+		OutLanding = Evaluate(Location, Velocity, GravityZ, OutTime);
+		return true;
+	}
+
+	/**
+	 * Earliest time each target can be landed on from an airborne arc, or negative if it cannot.
+	 * A target counts as landed on when the arc falls through its height within TargetRadius of it horizontally.
+	 * Launch options are set up once, then every target runs the same branch-light loop.
+	 */
+	static void SolveReachability(
+		const FVector& Location,
+		const FVector& Velocity,
+		const FVector& Forward,
+		float GravityZ,
+		bool bCanDoubleJump,
+		float TargetRadius,
+		const UParkourTuning& Tuning,
+		TConstArrayView<FVector> Targets,
+		TArrayView<float> OutTimes)
+	{
+		check(Targets.Num() == OutTimes.Num());
+
+		// Start of the Final Arc of Each Launch Option
+		constexpr int32 MaxOptions = NumDoubleJumpTimes + 1;
+		FVector OptionLocations[MaxOptions];
+		FVector OptionVelocities[MaxOptions];
+		float OptionStartTimes[MaxOptions];
+		int32 NumOptions = 1;
+
+		OptionLocations[0] = Location;
+		OptionVelocities[0] = Velocity;
+		OptionStartTimes[0] = 0.f;
+
+		// Double Jumping Later Never Reaches a Target a Double Jump Could not Rise to from Lower Down
+		float LowestTargetZ = UE_BIG_NUMBER;
+		for (const FVector& Target : Targets)
+		{
+			LowestTargetZ = FMath::Min(LowestTargetZ, Target.Z);
+		}
+
+		const float LatestTime = bCanDoubleJump && GravityZ < 0.f && Targets.Num() > 0
+			? LatestDoubleJumpTime(Location.Z, Velocity.Z, GravityZ, LowestTargetZ, Tuning)
+			: -1.f;
+
+		if (LatestTime >= 0.f)
+		{
+			// Double Jump Anywhere Between Now and the Latest Time, Also While Already Falling
+			for (int32 Index = 0; Index < NumDoubleJumpTimes; ++Index)
+			{
+				const float Time = LatestTime * Index / (NumDoubleJumpTimes - 1);
+				const FVector ArcVelocity = Velocity + FVector(0.f, 0.f, GravityZ * Time);
+
+				OptionLocations[NumOptions] = Evaluate(Location, Velocity, GravityZ, Time);
+				OptionVelocities[NumOptions] = DoubleJumpVelocity(ArcVelocity, Forward, Tuning);
+				OptionStartTimes[NumOptions] = Time;
+				++NumOptions;
+			}
+		}
+
+		const float TargetRadiusSquared = FMath::Square(TargetRadius);
+
+		for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+		{
+			const FVector& Target = Targets[TargetIndex];
+			float BestTime = -1.f;
+
+			for (int32 Option = 0; Option < NumOptions; ++Option)
+			{
+				const float FallTime = FallTimeToHeight(OptionLocations[Option].Z, OptionVelocities[Option].Z, GravityZ, Target.Z);
+				const FVector Landing = Evaluate(OptionLocations[Option], OptionVelocities[Option], GravityZ, FallTime);
+				const float Time = OptionStartTimes[Option] + FallTime;
+
+				const bool bLanded = FallTime >= 0.f && FVector::DistSquared2D(Landing, Target) <= TargetRadiusSquared;
+				BestTime = bLanded && (BestTime < 0.f || Time < BestTime) ? Time : BestTime;
+			}
+
+			OutTimes[TargetIndex] = BestTime;
+		}
+	}
+};
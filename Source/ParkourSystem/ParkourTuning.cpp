@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourTuning.h"
+#include "Algo/BinarySearch.h"
+
+FOnParkourTuningChanged UParkourTuning::OnTuningChanged;
+
+UParkourTuning::UParkourTuning()
+	: VerticalJumpForce(450.f)
+	, HorizontalJumpForce(100.f)
+	, SprintSpeed(1000.f)
+	, SprintJumpForce(200.f)
+	, SprintCooldown(0.1f)
+	, CrouchCapsuleHalfHeight(35.f)
+	, CrouchCameraZOffset(60.f)
+	, CrouchInterpSpeed(10.f)
+	, SlideSpeed(1000.f)
+	, SlideForceMultiplier(100.f)
+	, SlideStopSpeed(35.f)
+	, SlideBrakingDeceleration(1000.f)
+	, SlideCooldown(0.f)
+	, CoyoteTime(0.12f)
+	, InputBufferWindow(0.15f)
+	, SprintFOVKick(5.f)
+	, SlideCameraRoll(-4.f)
+	, LandingDipDepth(6.f)
+	, LandingDipDuration(0.25f)
+	, CameraEffectInterpSpeed(8.f)
+	, MomentumCarryRatio(1.1f)
+	, MomentumSpeedBudget(1500.f)
+{
+	RecomputeDerivedValues();
+}
+
+// Recompute Derived Values
+void UParkourTuning::RecomputeDerivedValues()
+{
+	SlideSpeedSquared = FMath::Square(SlideSpeed);
+	SlideStopSpeedSquared = FMath::Square(SlideStopSpeed);
+	SlideForce = SlideSpeed * SlideForceMultiplier;
+
+	SlideSurfaceLookup.Reset(SlideSurfaces.Num());
+	for (const FParkourSlideSurface& Surface : SlideSurfaces)
+	{
+		if (Surface.PhysicalMaterial != nullptr)
+		{
+			SlideSurfaceLookup.Add(Surface);
+		}
+	}
+	SlideSurfaceLookup.Sort([](const FParkourSlideSurface& A, const FParkourSlideSurface& B)
+	{
+		return A.PhysicalMaterial < B.PhysicalMaterial;
+	});
+}
+
+// Find Slide Behaviour of a Physical Material
+const FParkourSlideSurface& UParkourTuning::FindSlideSurface(const UPhysicalMaterial* PhysicalMaterial) const
+{
+	const int32 Index = Algo::BinarySearchBy(SlideSurfaceLookup, PhysicalMaterial, [](const FParkourSlideSurface& Surface)
+	{
+		return static_cast<const UPhysicalMaterial*>(Surface.PhysicalMaterial);
+	});
+
+	return Index != INDEX_NONE ? SlideSurfaceLookup[Index] : DefaultSlideSurface;
+}
+
+void UParkourTuning::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	RecomputeDerivedValues();
+}
+
+void UParkourTuning::PostLoad()
+{
+	Super::PostLoad();
+
+	RecomputeDerivedValues();
+}
+
+#if WITH_EDITOR
+// Apply Edited Values to All Live Characters
+void UParkourTuning::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RecomputeDerivedValues();
+	OnTuningChanged.Broadcast(this);
+}
+#endif
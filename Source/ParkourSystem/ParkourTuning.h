@@ -0,0 +1,193 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "ParkourTuning.generated.h"
+
+class UParkourTuning;
+class UPhysicalMaterial;
+
+// Broadcast When a Tuning Asset is Edited, so that Live Characters can Reapply It
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnParkourTuningChanged, const UParkourTuning*);
+
+/**
+ * How sliding behaves on a physical material, as scales of the slide tuning.
+ */
+USTRUCT(BlueprintType)
+struct FParkourSlideSurface
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide)
+	UPhysicalMaterial* PhysicalMaterial = nullptr;
+
+	// Scale of Slope Force While Sliding
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "0"))
+	float AccelerationScale = 1.f;
+
+	// Scale of Braking Deceleration While Sliding
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "0"))
+	float DecelerationScale = 1.f;
+
+	// Scale of Max Slide Speed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "0.01"))
+	float MaxSpeedScale = 1.f;
+};
+
+/**
+ * Parkour tuning values shared by reference among characters.
+ * Derived values are precomputed on load and on edit so the per-frame code never recomputes them.
+ */
+UCLASS(BlueprintType)
+class PARKOURSYSTEM_API UParkourTuning : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UParkourTuning();
+
+public:
+	/** Jump */
+
+	// Upward Force of Jumping
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Jump)
+	float VerticalJumpForce;
+
+	// Horizontal Force of Jumping
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Jump)
+	float HorizontalJumpForce;
+
+public:
+	/** Sprint */
+
+	// Speed of Sprint
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Sprint, meta = (ClampMin = "1"))
+	float SprintSpeed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Sprint)
+	float SprintJumpForce;
+
+	// Seconds Before Sprint Can Start Again After It Ended
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Sprint, meta = (ClampMin = "0"))
+	float SprintCooldown;
+
+public:
+	/** Crouch */
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Crouch)
+	float CrouchCapsuleHalfHeight;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Crouch)
+	float CrouchCameraZOffset;
+
+	// Interp Speed of Capsule Height and Camera Offset When Crouching or Standing up
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Crouch, meta = (ClampMin = "0"))
+	float CrouchInterpSpeed;
+
+public:
+	/** Slide */
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "1"))
+	float SlideSpeed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide)
+	float SlideForceMultiplier;
+
+	// Slide Finishes When Speed Drops Below This Value
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "0"))
+	float SlideStopSpeed;
+
+	// Braking Deceleration While Sliding
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "0"))
+	float SlideBrakingDeceleration;
+
+	// Seconds Before Slide Can Start Again After It Ended
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide, meta = (ClampMin = "0"))
+	float SlideCooldown;
+
+	// Slide Behaviour per Physical Material, Default Scales are Used for Materials not Listed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Slide)
+	TArray<FParkourSlideSurface> SlideSurfaces;
+
+public:
+	/** Input */
+
+	// Seconds After Walking Off a Ledge a Jump Still Counts as from the Ground
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input, meta = (ClampMin = "0"))
+	float CoyoteTime;
+
+	// Seconds a Press that Could Not Act Yet is Kept, Resolved on Landing
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Input, meta = (ClampMin = "0"))
+	float InputBufferWindow;
+
+public:
+	/** Camera, Evaluated Only for Locally Controlled Characters */
+
+	// Field of View Added While Sprinting or Sliding
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera)
+	float SprintFOVKick;
+
+	// Camera Roll in Degrees While Sliding
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera)
+	float SlideCameraRoll;
+
+	// How Far the Camera Dips When Landing
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera, meta = (ClampMin = "0"))
+	float LandingDipDepth;
+
+	// Seconds the Landing Dip Lasts
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera, meta = (ClampMin = "0.01"))
+	float LandingDipDuration;
+
+	// Interp Speed of FOV Kick and Roll
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Camera, meta = (ClampMin = "0"))
+	float CameraEffectInterpSpeed;
+
+public:
+	/** Momentum */
+
+	// Ratio of Horizontal Speed Carried into the Next Link of a Chain
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Momentum, meta = (ClampMin = "0"))
+	float MomentumCarryRatio;
+
+	// Upper Bound of Horizontal Speed Carried Through a Chain
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Momentum, meta = (ClampMin = "0"))
+	float MomentumSpeedBudget;
+
+public:
+	/** Derived Values, Updated by RecomputeDerivedValues() */
+
+	float SlideSpeedSquared;
+
+	float SlideStopSpeedSquared;
+
+	// SlideSpeed * SlideForceMultiplier
+	float SlideForce;
+
+	// Recompute Derived Values from Edited Ones
+	void RecomputeDerivedValues();
+
+	// Find Slide Behaviour of a Physical Material
+	const FParkourSlideSurface& FindSlideSurface(const UPhysicalMaterial* PhysicalMaterial) const;
+
+private:
+	// SlideSurfaces Sorted by Material, Looked up by Binary Search
+	TArray<FParkourSlideSurface> SlideSurfaceLookup;
+
+	// Returned for Materials not in SlideSurfaces
+	FParkourSlideSurface DefaultSlideSurface;
+
+public:
+	// Called When Any Tuning Asset was Edited
+	static FOnParkourTuningChanged OnTuningChanged;
+
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+};
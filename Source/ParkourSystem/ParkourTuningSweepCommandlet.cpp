@@ -0,0 +1,339 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourTuningSweepCommandlet.h"
+#include "ParkourBotController.h"
+#include "ParkourMode.h"
+#include "ParkourRoute.h"
+#include "ParkourSystemCharacter.h"
+#include "ParkourTestFixture.h"
+#include "ParkourTuning.h"
+#include "Components/CapsuleComponent.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY(LogParkourTuningSweep);
+
+#if WITH_EDITOR
+
+namespace ParkourTuningSweep
+{
+	// One Swept Tuning Value, Steps Evenly Spaced from Min to Max
+	struct FAxis
+	{
+		const TCHAR* Name;
+		float UParkourTuning::* Member;
+		float Min;
+		float Max;
+		int32 Steps;
+
+		float GetValue(int32 Step) const
+		{
+			return Steps > 1 ? FMath::Lerp(Min, Max, static_cast<float>(Step) / (Steps - 1)) : Min;
+		}
+	};
+
+	// Metrics of One Run
+	struct FRun
+	{
+		int32 VectorIndex = 0;
+		AParkourSystemCharacter* Character = nullptr;
+		FVector LastLocation = FVector::ZeroVector;
+		float PathDistance = 0.f;
+		float SlideDistance = 0.f;
+		float MaxSpeed = 0.f;
+		float CourseTime = -1.f;
+	};
+
+	// Parse "-Name=Min,Max,Steps", Falling Back to the Class Default as a Single Step
+	static FAxis ParseAxis(const FString& Params, const TCHAR* Name, float UParkourTuning::* Member)
+	{
+		const float Default = GetDefault<UParkourTuning>()->*Member;
+		FAxis Axis{ Name, Member, Default, Default, 1 };
+
+		FString Spec;
+		if (FParse::Value(*Params, *FString::Printf(TEXT("%s="), Name), Spec, false))
+		{
+			TArray<FString> Parts;
+			Spec.ParseIntoArray(Parts, TEXT(","));
+			if (Parts.Num() == 3)
+			{
+				Axis.Min = FCString::Atof(*Parts[0]);
+				Axis.Max = FCString::Atof(*Parts[1]);
+				Axis.Steps = FMath::Max(FCString::Atoi(*Parts[2]), 1);
+			}
+			else
+			{
+				UE_LOG(LogParkourTuningSweep, Warning, TEXT("-%s expects Min,Max,Steps, got '%s'"), Name, *Spec);
+			}
+		}
+
+		return Axis;
+	}
+
+	// Tuning Vector at a Grid Index, First Axis Varies Fastest
+	static UParkourTuning* CreateTuning(const TArray<FAxis>& Axes, int32 VectorIndex)
+	{
+		UParkourTuning* Tuning = NewObject<UParkourTuning>(GetTransientPackage());
+		for (const FAxis& Axis : Axes)
+		{
+			Tuning->*Axis.Member = Axis.GetValue(VectorIndex % Axis.Steps);
+			VectorIndex /= Axis.Steps;
+		}
+		Tuning->RecomputeDerivedValues();
+		return Tuning;
+	}
+}
+
+#endif
+
+UParkourTuningSweepCommandlet::UParkourTuningSweepCommandlet()
+	: Route(nullptr)
+{
+	IsClient = false;
+	IsServer = true;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UParkourTuningSweepCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	using namespace ParkourTuningSweep;
+
+	const TArray<FAxis> Axes = {
+		ParseAxis(Params, TEXT("SlideSpeed"), &UParkourTuning::SlideSpeed),
+		ParseAxis(Params, TEXT("SlideForceMultiplier"), &UParkourTuning::SlideForceMultiplier),
+		ParseAxis(Params, TEXT("VerticalJumpForce"), &UParkourTuning::VerticalJumpForce),
+		ParseAxis(Params, TEXT("CrouchInterpSpeed"), &UParkourTuning::CrouchInterpSpeed),
+	};
+
+	int32 BatchSize = 256;
+	float SimulatedSeconds = 10.f;
+	float CourseLength = 3000.f;
+	float Fps = 60.f;
+	int32 Shard = 0;
+	int32 NumShards = 1;
+	FString MapName;
+	FString RoutePath;
+	FParse::Value(*Params, TEXT("Batch="), BatchSize);
+	FParse::Value(*Params, TEXT("Seconds="), SimulatedSeconds);
+	FParse::Value(*Params, TEXT("CourseLength="), CourseLength);
+	FParse::Value(*Params, TEXT("Fps="), Fps);
+	FParse::Value(*Params, TEXT("Shard="), Shard);
+	FParse::Value(*Params, TEXT("NumShards="), NumShards);
+	FParse::Value(*Params, TEXT("Map="), MapName);
+	FParse::Value(*Params, TEXT("Route="), RoutePath);
+
+	BatchSize = FMath::Max(BatchSize, 1);
+	NumShards = FMath::Max(NumShards, 1);
+	Shard = FMath::Clamp(Shard, 0, NumShards - 1);
+	const float DeltaSeconds = 1.f / FMath::Max(Fps, 1.f);
+	const int32 NumFrames = FMath::CeilToInt(SimulatedSeconds / DeltaSeconds);
+
+	if (!RoutePath.IsEmpty())
+	{
+		Route = LoadObject<UParkourRoute>(nullptr, *RoutePath);
+		if (Route == nullptr)
+		{
+			UE_LOG(LogParkourTuningSweep, Warning, TEXT("Route '%s' was not found, using the built-in route"), *RoutePath);
+		}
+	}
+
+	int32 NumVectors = 1;
+	for (const FAxis& Axis : Axes)
+	{
+		NumVectors *= Axis.Steps;
+	}
+
+	// This Shard's Slice of the Grid
+	TArray<int32> VectorIndices;
+	for (int32 VectorIndex = Shard; VectorIndex < NumVectors; VectorIndex += NumShards)
+	{
+		VectorIndices.Add(VectorIndex);
+	}
+
+	UWorld* World = CreateCourseWorld(MapName);
+	if (World == nullptr)
+	{
+		return 1;
+	}
+
+	UClass* CharacterClass = ParkourTestFixture::GetCharacterClass(World);
+
+	// Every Run Starts at the Same Spot, the Map's Player Start or Just Above the Flat Floor
+	FTransform StartTransform(FRotator::ZeroRotator, FVector(0.f, 0.f, 120.f));
+	if (!MapName.IsEmpty())
+	{
+		if (TActorIterator<APlayerStart> It(World); It)
+		{
+			StartTransform = FTransform(It->GetActorRotation(), It->GetActorLocation());
+		}
+		else
+		{
+			UE_LOG(LogParkourTuningSweep, Warning, TEXT("Map '%s' has no player start, runs start at %s"), *MapName, *StartTransform.GetLocation().ToString());
+		}
+	}
+
+	const FString CsvPath = FPaths::ProfilingDir() / FString::Printf(TEXT("ParkourTuningSweep_%d.csv"), Shard);
+	FString Csv = TEXT("Index");
+	for (const FAxis& Axis : Axes)
+	{
+		Csv += FString::Printf(TEXT(",%s"), Axis.Name);
+	}
+	Csv += TEXT(",CourseTime,SlideDistance,MaxSpeed,PathDistance\n");
+
+	UE_LOG(LogParkourTuningSweep, Display, TEXT("Shard %d/%d: %d of %d tuning vectors, batches of %d, %d frames each"),
+		Shard, NumShards, VectorIndices.Num(), NumVectors, BatchSize, NumFrames);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	TArray<FRun> Runs;
+	Runs.Reserve(BatchSize);
+	for (int32 BatchStart = 0; BatchStart < VectorIndices.Num(); BatchStart += BatchSize)
+	{
+		// Characters Ignore Each Other
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		Runs.Reset();
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, VectorIndices.Num());
+		for (int32 Index = BatchStart; Index < BatchEnd; ++Index)
+		{
+			AParkourSystemCharacter* Character = World->SpawnActorDeferred<AParkourSystemCharacter>(CharacterClass, StartTransform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			if (Character == nullptr)
+			{
+				continue;
+			}
+			Character->Tuning = CreateTuning(Axes, VectorIndices[Index]);
+			Character->FinishSpawning(StartTransform);
+			Character->GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+
+			AParkourBotController* Bot = World->SpawnActor<AParkourBotController>(AParkourBotController::StaticClass(), StartTransform, SpawnParams);
+			if (Bot == nullptr)
+			{
+				Character->Destroy();
+				continue;
+			}
+			Bot->Route = Route;
+			Bot->Possess(Character);
+
+			FRun& Run = Runs.AddDefaulted_GetRef();
+			Run.VectorIndex = VectorIndices[Index];
+			Run.Character = Character;
+			Run.LastLocation = Character->GetActorLocation();
+		}
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, DeltaSeconds);
+			++GFrameCounter;
+
+			const float Now = (Frame + 1) * DeltaSeconds;
+			for (FRun& Run : Runs)
+			{
+				const FVector Location = Run.Character->GetActorLocation();
+				const float Step = FVector::Dist2D(Location, Run.LastLocation);
+				Run.LastLocation = Location;
+
+				Run.PathDistance += Step;
+				if (Run.Character->GetParkourMode() == EParkourMode::EPM_Slide)
+				{
+					Run.SlideDistance += Step;
+				}
+				Run.MaxSpeed = FMath::Max(Run.MaxSpeed, Run.Character->GetCharacterMovement()->Velocity.Size2D());
+
+				if (Run.CourseTime < 0.f && Run.PathDistance >= CourseLength)
+				{
+					Run.CourseTime = Now;
+				}
+			}
+		}
+
+		for (const FRun& Run : Runs)
+		{
+			Csv += FString::Printf(TEXT("%d"), Run.VectorIndex);
+			for (const FAxis& Axis : Axes)
+			{
+				Csv += FString::Printf(TEXT(",%.3f"), Run.Character->Tuning->*Axis.Member);
+			}
+			Csv += FString::Printf(TEXT(",%.3f,%.1f,%.1f,%.1f\n"), Run.CourseTime, Run.SlideDistance, Run.MaxSpeed, Run.PathDistance);
+
+			if (AController* Bot = Run.Character->GetController())
+			{
+				Bot->Destroy();
+			}
+			Run.Character->Destroy();
+		}
+
+		// Drop Destroyed Characters and Their Tuning Assets Before the Next Batch
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		UE_LOG(LogParkourTuningSweep, Display, TEXT("%d/%d tuning vectors done, %.0f per hour"),
+			BatchEnd, VectorIndices.Num(), BatchEnd / FMath::Max(FPlatformTime::Seconds() - StartSeconds, 1e-3) * 3600.0);
+	}
+
+	DestroyCourseWorld(World);
+
+	if (!FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogParkourTuningSweep, Error, TEXT("Failed to write %s"), *CsvPath);
+		return 1;
+	}
+
+	UE_LOG(LogParkourTuningSweep, Display, TEXT("Wrote %s"), *CsvPath);
+	return 0;
+#else
+	UE_LOG(LogParkourTuningSweep, Error, TEXT("The tuning sweep runs in editor builds only"));
+	return 1;
+#endif
+}
+
+#if WITH_EDITOR
+
+// Load the Course Map, or Create a World with a Flat Floor
+UWorld* UParkourTuningSweepCommandlet::CreateCourseWorld(const FString& MapName)
+{
+	if (MapName.IsEmpty())
+	{
+		UWorld* World = ParkourTestFixture::CreateWorld(TEXT("ParkourTuningSweep"));
+
+		// 2km Square Floor Made of the Engine Cube
+		ParkourTestFixture::SpawnBox(World, FVector(0.f, 0.f, -50.f), FVector(100000.f, 100000.f, 50.f));
+
+		return World;
+	}
+
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogParkourTuningSweep, Error, TEXT("Map '%s' was not found"), *MapName);
+		return nullptr;
+	}
+
+	World->WorldType = EWorldType::Game;
+	World->AddToRoot();
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues().AllowAudioPlayback(false));
+	}
+
+	ParkourTestFixture::StartWorld(World);
+
+	return World;
+}
+
+// Tear Down a World Made by CreateCourseWorld()
+void UParkourTuningSweepCommandlet::DestroyCourseWorld(UWorld* World)
+{
+	ParkourTestFixture::DestroyWorld(World);
+}
+
+#endif
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ParkourTuningSweepCommandlet.generated.h"
+
+class UParkourRoute;
+class UWorld;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogParkourTuningSweep, Log, All);
+
+/**
+ * Headless tuning sweep. Runs every tuning vector of a parameter grid through a parkour route and writes course time,
+ * slide distance and max speed of each to a CSV.
+ *
+ * A batch of characters shares one world, each with its own tuning asset and ignoring the others' collision,
+ * so every character is an independent run and per-character updates spread across cores through UParkourUpdateSubsystem.
+ * Worlds tick on the game thread only, so the remaining cores are filled by running shards as separate processes.
+ *
+ * Options:
+ *   -SlideSpeed=Min,Max,Steps            Also -SlideForceMultiplier, -VerticalJumpForce, -CrouchInterpSpeed, default is the class default
+ *   -Map=<PackageName>                   Course map, runs start at its first player start, a flat floor if omitted
+ *   -Route=<ObjectPath>                  UParkourRoute asset, built-in route if omitted
+ *   -Batch=N                             Characters simulated together (default 256)
+ *   -Seconds=S                           Simulated seconds per run (default 10)
+ *   -CourseLength=D                      Path length that finishes the course (default 3000)
+ *   -Fps=F                               Fixed simulation rate (default 60)
+ *   -Shard=I -NumShards=N                Run every Nth vector starting at I, one process per core
+ *
+ * e.g. "UnrealEditor-Cmd ParkourSystem.uproject -run=ParkourTuningSweep -SlideSpeed=800,1600,9 -VerticalJumpForce=350,550,5 -Shard=0 -NumShards=16 -nullrhi -unattended"
+ * Writes Saved/Profiling/ParkourTuningSweep_<Shard>.csv. Editor builds only, as it runs on the test fixture.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourTuningSweepCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UParkourTuningSweepCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+#if WITH_EDITOR
+	// Load the Course Map, or Create a World with a Flat Floor
+	UWorld* CreateCourseWorld(const FString& MapName);
+
+	// Tear Down a World Made by CreateCourseWorld()
+	void DestroyCourseWorld(UWorld* World);
+#endif
+
+	UPROPERTY()
+	UParkourRoute* Route;
+};
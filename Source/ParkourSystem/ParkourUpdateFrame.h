@@ -0,0 +1,57 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ParkourSlideKernel.h"
+
+/**
+ * Everything a character's per-frame parkour update reads and computes.
+ * Gathered and applied on the game thread; Compute() only touches the frame, so it can run on any thread.
+ */
+struct FParkourUpdateFrame
+{
+	/** Gathered */
+
+	FVector Velocity;
+
+	FVector FloorNormal;
+
+	// Slide Values with the Surface Applied
+	float SlideForce;
+
+	float SlideMaxSpeed;
+
+	float SlideMaxSpeedSquared;
+
+	float SlideStopSpeedSquared;
+
+	float CapsuleHalfHeight;
+
+	float TargetCapsuleHalfHeight;
+
+	float CrouchInterpSpeed;
+
+	// If Slide Step Should Run
+	uint8 bSliding : 1;
+
+	// If Sprint Should Finish, No Forward Input
+	uint8 bEndSprint : 1;
+
+	/** Computed */
+
+	FParkourSlideKernel::FResult Slide;
+
+	float NewCapsuleHalfHeight;
+
+	// Pure Math of the Update
+	FORCEINLINE void Compute(float DeltaSeconds)
+	{
+		if (bSliding)
+		{
+			Slide = FParkourSlideKernel::Step(Velocity, FloorNormal, SlideForce, SlideMaxSpeed, SlideMaxSpeedSquared, SlideStopSpeedSquared);
+		}
+
+		NewCapsuleHalfHeight = FMath::FInterpTo(CapsuleHalfHeight, TargetCapsuleHalfHeight, DeltaSeconds, CrouchInterpSpeed);
+	}
+};
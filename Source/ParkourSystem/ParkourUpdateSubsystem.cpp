@@ -0,0 +1,160 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourUpdateSubsystem.h"
+#include "ParkourSystemCharacter.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarParkourParallelUpdate(
+	TEXT("parkour.ParallelUpdate"),
+	true,
+	TEXT("Compute the parkour update of many characters on worker threads."));
+
+static TAutoConsoleVariable<int32> CVarParkourParallelUpdateMinCharacters(
+	TEXT("parkour.ParallelUpdateMinCharacters"),
+	64,
+	TEXT("Fewest registered characters for which parkour.ParallelUpdate goes wide."));
+
+void FParkourUpdateTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem != nullptr && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Subsystem->UpdateCharacters(DeltaTime);
+	}
+}
+
+FString FParkourUpdateTickFunction::DiagnosticMessage()
+{
+	return TEXT("FParkourUpdateTickFunction");
+}
+
+bool UParkourUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UParkourUpdateSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.Subsystem = this;
+	TickFunction.TickGroup = TG_PrePhysics;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = true;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UParkourUpdateSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	TickFunction.Subsystem = nullptr;
+
+	Characters.Reset();
+	Frames.Reset();
+
+	Super::Deinitialize();
+}
+
+// Update Character Here from Now on, Disabling Its Actor Tick Where Possible
+void UParkourUpdateSubsystem::Register(AParkourSystemCharacter* Character)
+{
+	if (Character == nullptr || Characters.Contains(Character))
+	{
+		return;
+	}
+
+	// Frames Added During the Update Pass Could Move the Frame Being Applied, so They Come After It
+	Characters.Add(Character);
+	if (!bIsUpdating)
+	{
+		Frames.AddDefaulted();
+	}
+
+	// Movement Uses the Result, so It Still Runs After the Update
+	Character->GetCharacterMovement()->PrimaryComponentTick.AddPrerequisite(this, TickFunction);
+
+	// Blueprints Implementing Event Tick Keep Their Actor Tick
+	if (!Character->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AActor, ReceiveTick)))
+	{
+		Character->SetActorTickEnabled(false);
+	}
+}
+
+void UParkourUpdateSubsystem::Unregister(AParkourSystemCharacter* Character)
+{
+	const int32 Index = Characters.Find(Character);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Character->GetCharacterMovement()->PrimaryComponentTick.RemovePrerequisite(this, TickFunction);
+
+	// A Character Applying Its Update may Unregister Itself or Others, e.g. When Returned to the Respawn Pool
+	if (bIsUpdating)
+	{
+		Characters[Index] = nullptr;
+		++NumDeferredRemovals;
+		return;
+	}
+
+	Characters.RemoveAtSwap(Index);
+	Frames.RemoveAtSwap(Index);
+}
+
+// Remove Slots Nulled During the Update Pass
+void UParkourUpdateSubsystem::CompactCharacters()
+{
+	for (int32 Index = Characters.Num() - 1; Index >= 0 && NumDeferredRemovals > 0; --Index)
+	{
+		if (Characters[Index] == nullptr)
+		{
+			Characters.RemoveAtSwap(Index);
+			Frames.RemoveAtSwap(Index);
+			--NumDeferredRemovals;
+		}
+	}
+
+	NumDeferredRemovals = 0;
+}
+
+// Update All Registered Characters
+void UParkourUpdateSubsystem::UpdateCharacters(float DeltaSeconds)
+{
+	const int32 NumCharacters = Characters.Num();
+	bIsUpdating = true;
+
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		if (AParkourSystemCharacter* Character = Characters[Index])
+		{
+			Character->GatherParkourUpdate(Frames[Index]);
+		}
+	}
+
+	const bool bParallel = CVarParkourParallelUpdate.GetValueOnGameThread() && NumCharacters >= CVarParkourParallelUpdateMinCharacters.GetValueOnGameThread();
+	ParallelFor(NumCharacters, [this, DeltaSeconds](int32 Index)
+	{
+		Frames[Index].Compute(DeltaSeconds);
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		if (AParkourSystemCharacter* Character = Characters[Index])
+		{
+			Character->ApplyParkourUpdate(Frames[Index], DeltaSeconds);
+		}
+	}
+
+	bIsUpdating = false;
+	Frames.SetNum(Characters.Num());
+	if (NumDeferredRemovals > 0)
+	{
+		CompactCharacters();
+	}
+}
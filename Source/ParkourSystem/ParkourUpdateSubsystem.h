@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ParkourUpdateFrame.h"
+#include "ParkourUpdateSubsystem.generated.h"
+
+class AParkourSystemCharacter;
+class UParkourUpdateSubsystem;
+
+// Single Tick in TG_PrePhysics Updating All Registered Characters
+USTRUCT()
+struct FParkourUpdateTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UParkourUpdateSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FParkourUpdateTickFunction> : public TStructOpsTypeTraitsBase2<FParkourUpdateTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Runs the per-frame parkour update of all characters as one loop over a dense array, instead of one actor tick each.
+ * Gathers on the game thread, computes the pure math (optionally with ParallelFor), then applies on the game thread.
+ * Character movement ticks after it, as it did after the actor tick.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourUpdateSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Update Character Here from Now on, Disabling Its Actor Tick Where Possible
+	void Register(AParkourSystemCharacter* Character);
+
+	void Unregister(AParkourSystemCharacter* Character);
+
+	// Update All Registered Characters
+	void UpdateCharacters(float DeltaSeconds);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FParkourUpdateTickFunction TickFunction;
+
+	// Registered Characters, Unregistered in Their EndPlay, Null While Removal is Deferred
+	TArray<AParkourSystemCharacter*> Characters;
+
+	// Frame per Character, Same Index as Characters
+	TArray<FParkourUpdateFrame> Frames;
+
+	// Set During UpdateCharacters(), Unregister() Then Only Nulls the Slot so Indices Stay Valid
+	bool bIsUpdating = false;
+
+	// Slots Nulled During the Update Pass, Removed Once It Ends
+	int32 NumDeferredRemovals = 0;
+
+	// Remove Slots Nulled During the Update Pass
+	void CompactCharacters();
+};
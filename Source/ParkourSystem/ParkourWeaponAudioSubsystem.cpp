@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ParkourWeaponAudioSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarParkourWeaponVoiceBudget(
+	TEXT("parkour.WeaponVoiceBudget"),
+	8,
+	TEXT("New weapon voices allowed to start per frame across all weapons, 0 for no limit."));
+
+static TAutoConsoleVariable<float> CVarParkourWeaponVoiceCullDistance(
+	TEXT("parkour.WeaponVoiceCullDistance"),
+	6000.f,
+	TEXT("Weapon voices farther than this from every local listener are not started, 0 to disable culling."));
+
+bool UParkourWeaponAudioSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return PARKOUR_WITH_COSMETICS && (WorldType == EWorldType::Game || WorldType == EWorldType::PIE);
+}
+
+bool UParkourWeaponAudioSubsystem::RequestVoice(const FVector& Location)
+{
+	if (!bListenersValid)
+	{
+		RefreshListeners();
+	}
+
+	// Nobody Can Hear It, e.g. on a Dedicated Server
+	if (ListenerLocations.IsEmpty())
+	{
+		++DistanceCulledCount;
+		return false;
+	}
+
+	const float CullDistance = CVarParkourWeaponVoiceCullDistance.GetValueOnGameThread();
+	if (CullDistance > 0.f)
+	{
+		const float CullDistanceSquared = FMath::Square(CullDistance);
+		const bool bInRange = ListenerLocations.ContainsByPredicate([&](const FVector& ListenerLocation)
+		{
+			return FVector::DistSquared(ListenerLocation, Location) <= CullDistanceSquared;
+		});
+
+		if (!bInRange)
+		{
+			++DistanceCulledCount;
+			return false;
+		}
+	}
+
+	const int32 Budget = CVarParkourWeaponVoiceBudget.GetValueOnGameThread();
+	if (Budget > 0 && VoicesThisFrame >= Budget)
+	{
+		++BudgetCulledCount;
+		return false;
+	}
+
+	++VoicesThisFrame;
+	return true;
+}
+
+void UParkourWeaponAudioSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	VoicesThisFrame = 0;
+	bListenersValid = false;
+}
+
+TStatId UParkourWeaponAudioSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UParkourWeaponAudioSubsystem, STATGROUP_Tickables);
+}
+
+// Cache Listener Locations of Local Players, Once per Frame at Most
+void UParkourWeaponAudioSubsystem::RefreshListeners()
+{
+	ListenerLocations.Reset();
+	bListenersValid = true;
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController == nullptr || !PlayerController->IsLocalPlayerController())
+		{
+			continue;
+		}
+
+		FVector Location;
+		FVector FrontDir;
+		FVector RightDir;
+		PlayerController->GetAudioListenerPosition(Location, FrontDir, RightDir);
+		ListenerLocations.Add(Location);
+	}
+}
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ParkourWeaponAudioSubsystem.generated.h"
+
+/**
+ * Limits how many weapon voices may start in a frame, and culls voices too far from every local listener.
+ * Weapons ask before starting a voice; sounds already playing are not affected.
+ */
+UCLASS()
+class PARKOURSYSTEM_API UParkourWeaponAudioSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Claim One of This Frame's New Voices for a Sound at Location
+	//! @retval true Voice may Start
+	//! @retval false Over Budget or Out of Hearing Range of Every Listener
+	bool RequestVoice(const FVector& Location);
+
+	// Number of Voices Refused Since the World Began, by Budget and by Distance
+	int32 GetBudgetCulledCount() const { return BudgetCulledCount; }
+	int32 GetDistanceCulledCount() const { return DistanceCulledCount; }
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// End of FTickableGameObject interface
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Cache Listener Locations of Local Players, Once per Frame at Most
+	void RefreshListeners();
+
+private:
+	TArray<FVector, TInlineAllocator<4>> ListenerLocations;
+
+	// Voices Started Since the Last Tick
+	int32 VoicesThisFrame = 0;
+
+	int32 BudgetCulledCount = 0;
+
+	int32 DistanceCulledCount = 0;
+
+	bool bListenersValid = false;
+};
@@ -1,8 +1,11 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TP_PickUpComponent.h"
+#include "TP_WeaponComponent.h"
 
 UTP_PickUpComponent::UTP_PickUpComponent()
+	: PreloadRadius(1500.f)
+	, PreloadSphere(nullptr)
 {
 	// Setup the Sphere Collision
 	SphereRadius = 32.f;
@@ -14,6 +17,36 @@ void UTP_PickUpComponent::BeginPlay()
 
 	// Register our Overlap Event
 	OnComponentBeginOverlap.AddDynamic(this, &UTP_PickUpComponent::OnSphereBeginOverlap);
+
+	// Proximity Sphere, Only Needed While the Weapon Has Not Streamed in Yet
+	if (PreloadRadius > SphereRadius && GetOwner() && GetOwner()->FindComponentByClass<UTP_WeaponComponent>())
+	{
+		PreloadSphere = NewObject<USphereComponent>(GetOwner(), TEXT("PreloadSphere"));
+		PreloadSphere->SetupAttachment(this);
+		PreloadSphere->InitSphereRadius(PreloadRadius);
+		PreloadSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		PreloadSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+		PreloadSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+		PreloadSphere->OnComponentBeginOverlap.AddDynamic(this, &UTP_PickUpComponent::OnPreloadSphereBeginOverlap);
+		PreloadSphere->RegisterComponent();
+	}
+}
+
+void UTP_PickUpComponent::OnPreloadSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	if (Cast<AParkourSystemCharacter>(OtherActor) == nullptr)
+	{
+		return;
+	}
+
+	if (UTP_WeaponComponent* Weapon = GetOwner()->FindComponentByClass<UTP_WeaponComponent>())
+	{
+		Weapon->PreloadAssets();
+	}
+
+	// Streaming Only Needs to Start Once
+	PreloadSphere->OnComponentBeginOverlap.RemoveAll(this);
+	PreloadSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
 
 void UTP_PickUpComponent::OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -23,6 +23,11 @@ public:
 	FOnPickUp OnPickUp;
 
 	UTP_PickUpComponent();
+
+	/** Characters within this distance start streaming in the weapon's fire assets */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Interaction", meta = (ClampMin = "0"))
+	float PreloadRadius;
+
 protected:
 
 	/** Called when the game starts */
@@ -31,4 +36,13 @@ protected:
 	/** Code for when something overlaps this component */
 	UFUNCTION()
 	void OnSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	/** Code for when a character comes within PreloadRadius */
+	UFUNCTION()
+	void OnPreloadSphereBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+private:
+	/** Proximity sphere created at BeginPlay */
+	UPROPERTY(Transient)
+	USphereComponent* PreloadSphere;
 };
\ No newline at end of file
@@ -4,14 +4,24 @@
 #include "TP_WeaponComponent.h"
 #include "ParkourSystemCharacter.h"
 #include "ParkourSystemProjectile.h"
+#include "ParkourWeaponAudioSubsystem.h"
+#include "Components/AudioComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "TimerManager.h"
 
 // Sets default values for this component's properties
 UTP_WeaponComponent::UTP_WeaponComponent()
+	: LoopFireInterval(0.15f)
+	, AudioPoolSize(3)
+	, LoopAudioComponent(nullptr)
+	, NextStolenAudioIndex(0)
+	, LastFireTime(-1.0)
 {
 	// Default offset from the character location for projectiles to spawn
 	MuzzleOffset = FVector(100.0f, 0.0f, 10.0f);
@@ -25,8 +35,11 @@ void UTP_WeaponComponent::Fire()
 		return;
 	}
 
+	// Fired Before Streaming Finished, the Projectile Must Still Spawn so Load It Now
+	UClass* const LoadedProjectileClass = ProjectileClass.IsNull() ? nullptr : (ProjectileClass.Get() ? ProjectileClass.Get() : ProjectileClass.LoadSynchronous());
+
 	// Try and fire a projectile
-	if (ProjectileClass != nullptr)
+	if (LoadedProjectileClass != nullptr)
 	{
 		UWorld* const World = GetWorld();
 		if (World != nullptr)
@@ -41,26 +54,164 @@ void UTP_WeaponComponent::Fire()
 			ActorSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButDontSpawnIfColliding;
 	
 			// Spawn the projectile at the muzzle
-			World->SpawnActor<AParkourSystemProjectile>(ProjectileClass, SpawnLocation, SpawnRotation, ActorSpawnParams);
+			World->SpawnActor<AParkourSystemProjectile>(LoadedProjectileClass, SpawnLocation, SpawnRotation, ActorSpawnParams);
 		}
 	}
 	
+	// Sound and Animation are Skipped Until Streamed in, Rather than Hitching
+	PreloadAssets();
+
+#if PARKOUR_WITH_COSMETICS
 	// Try and play the sound if specified
-	if (FireSound != nullptr)
-	{
-		UGameplayStatics::PlaySoundAtLocation(this, FireSound, Character->GetActorLocation());
-	}
+	PlayFireAudio();
 	
 	// Try and play a firing animation if specified
-	if (FireAnimation != nullptr)
+	if (UAnimMontage* LoadedFireAnimation = FireAnimation.Get())
 	{
 		// Get the animation object for the arms mesh
 		UAnimInstance* AnimInstance = Character->GetMesh1P()->GetAnimInstance();
 		if (AnimInstance != nullptr)
 		{
-			AnimInstance->Montage_Play(FireAnimation, 1.f);
+			AnimInstance->Montage_Play(LoadedFireAnimation, 1.f);
+		}
+	}
+#endif
+}
+
+void UTP_WeaponComponent::PreloadAssets()
+{
+	if (AssetsHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+#if PARKOUR_WITH_COSMETICS
+	for (const FSoftObjectPath& AssetPath : { ProjectileClass.ToSoftObjectPath(), FireSound.ToSoftObjectPath(), FireLoopSound.ToSoftObjectPath(), FireTailSound.ToSoftObjectPath(), FireAnimation.ToSoftObjectPath() })
+#else
+	// Servers Only Spawn the Projectile
+	for (const FSoftObjectPath& AssetPath : { ProjectileClass.ToSoftObjectPath() })
+#endif
+	{
+		if (!AssetPath.IsNull())
+		{
+			AssetPaths.Add(AssetPath);
+		}
+	}
+
+	if (AssetPaths.Num() > 0)
+	{
+		AssetsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths);
+	}
+}
+
+// Play FireSound, or Keep the Fire Loop Going for Rapid Shots
+void UTP_WeaponComponent::PlayFireAudio()
+{
+	UWorld* const World = GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	const bool bRapidFire = LastFireTime >= 0.0 && Now - LastFireTime <= LoopFireInterval;
+	LastFireTime = Now;
+
+	// Loop Already Covers This Shot, Only Push Its Release Back
+	if (LoopAudioComponent != nullptr)
+	{
+		World->GetTimerManager().SetTimer(LoopReleaseTimer, this, &UTP_WeaponComponent::ReleaseFireLoop, LoopFireInterval);
+		return;
+	}
+
+	USoundBase* const LoopSound = FireLoopSound.Get();
+	USoundBase* const Sound = bRapidFire && LoopSound != nullptr ? LoopSound : FireSound.Get();
+	if (Sound == nullptr)
+	{
+		return;
+	}
+
+	// Budget and Distance Culling Shared by All Weapons in the World
+	UParkourWeaponAudioSubsystem* const AudioSubsystem = World->GetSubsystem<UParkourWeaponAudioSubsystem>();
+	if (AudioSubsystem != nullptr && !AudioSubsystem->RequestVoice(GetComponentLocation()))
+	{
+		return;
+	}
+
+	UAudioComponent* const AudioComponent = AcquireAudioComponent();
+	if (AudioComponent == nullptr)
+	{
+		return;
+	}
+
+	AudioComponent->SetSound(Sound);
+	AudioComponent->Play();
+
+	if (Sound == LoopSound)
+	{
+		LoopAudioComponent = AudioComponent;
+		World->GetTimerManager().SetTimer(LoopReleaseTimer, this, &UTP_WeaponComponent::ReleaseFireLoop, LoopFireInterval);
+	}
+}
+
+// Stop the Fire Loop and Play Its Tail on the Same Component
+void UTP_WeaponComponent::ReleaseFireLoop()
+{
+	UAudioComponent* const AudioComponent = LoopAudioComponent;
+	LoopAudioComponent = nullptr;
+
+	if (AudioComponent == nullptr)
+	{
+		return;
+	}
+
+	AudioComponent->Stop();
+
+	// Tail Continues the Loop's Voice, so It is not Counted Against the Budget
+	if (USoundBase* const TailSound = FireTailSound.Get())
+	{
+		AudioComponent->SetSound(TailSound);
+		AudioComponent->Play();
+	}
+}
+
+// Get an Idle Pooled Audio Component, Creating or Stealing One If Needed
+UAudioComponent* UTP_WeaponComponent::AcquireAudioComponent()
+{
+	for (UAudioComponent* AudioComponent : AudioPool)
+	{
+		if (AudioComponent != nullptr && !AudioComponent->IsPlaying())
+		{
+			return AudioComponent;
 		}
 	}
+
+	if (AudioPool.Num() < FMath::Max(AudioPoolSize, 1))
+	{
+		UAudioComponent* const AudioComponent = NewObject<UAudioComponent>(GetOwner());
+		AudioComponent->bAutoActivate = false;
+		AudioComponent->bAutoDestroy = false;
+		AudioComponent->SetupAttachment(this);
+		AudioComponent->RegisterComponent();
+		AudioPool.Add(AudioComponent);
+		return AudioComponent;
+	}
+
+	// Every Component is Playing, Cut the Oldest Shot Short
+	for (int32 Attempt = 0; Attempt < AudioPool.Num(); ++Attempt)
+	{
+		UAudioComponent* const AudioComponent = AudioPool[NextStolenAudioIndex];
+		NextStolenAudioIndex = (NextStolenAudioIndex + 1) % AudioPool.Num();
+
+		if (AudioComponent != nullptr && AudioComponent != LoopAudioComponent)
+		{
+			AudioComponent->Stop();
+			return AudioComponent;
+		}
+	}
+
+	return nullptr;
 }
 
 void UTP_WeaponComponent::AttachWeapon(AParkourSystemCharacter* TargetCharacter)
@@ -74,9 +225,11 @@ void UTP_WeaponComponent::AttachWeapon(AParkourSystemCharacter* TargetCharacter)
 	}
 
 	// Attach the weapon to the First Person Character
-	FAttachmentTransformRules AttachmentRules(EAttachmentRule::SnapToTarget, true);
-	AttachToComponent(Character->GetMesh1P(), AttachmentRules, FName(TEXT("GripPoint")));
+	AttachToCharacter();
 	
+	// Usually Streaming Already, Started When the Character Came Near the Pickup
+	PreloadAssets();
+
 	// switch bHasRifle so the animation blueprint can switch to another animation set
 	Character->SetHasRifle(true);
 
@@ -97,8 +250,40 @@ void UTP_WeaponComponent::AttachWeapon(AParkourSystemCharacter* TargetCharacter)
 	}
 }
 
+// Mesh1P is Unregistered on Server, Remote and AI Characters, so Its Transform Never Updates There
+void UTP_WeaponComponent::AttachToCharacter()
+{
+	if (Character == nullptr)
+	{
+		return;
+	}
+
+	FName SocketName;
+	USceneComponent* Parent = Character->GetWeaponAttachParent(SocketName);
+
+	FAttachmentTransformRules AttachmentRules(EAttachmentRule::SnapToTarget, true);
+	AttachToComponent(Parent, AttachmentRules, SocketName);
+}
+
 void UTP_WeaponComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	AssetsHandle.Reset();
+
+	if (UWorld* const World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(LoopReleaseTimer);
+	}
+	LoopAudioComponent = nullptr;
+
+	for (UAudioComponent* AudioComponent : AudioPool)
+	{
+		if (AudioComponent != nullptr)
+		{
+			AudioComponent->DestroyComponent();
+		}
+	}
+	AudioPool.Empty();
+
 	if (Character == nullptr)
 	{
 		return;
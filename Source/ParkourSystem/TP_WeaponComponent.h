@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/TimerHandle.h"
 #include "TP_WeaponComponent.generated.h"
 
 class AParkourSystemCharacter;
+class AParkourSystemProjectile;
+class UAudioComponent;
+struct FStreamableHandle;
 
 UCLASS(Blueprintable, BlueprintType, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class PARKOURSYSTEM_API UTP_WeaponComponent : public USkeletalMeshComponent
@@ -14,17 +18,33 @@ class PARKOURSYSTEM_API UTP_WeaponComponent : public USkeletalMeshComponent
 	GENERATED_BODY()
 
 public:
-	/** Projectile class to spawn */
+	/** Projectile class to spawn, streamed in by PreloadAssets() */
 	UPROPERTY(EditDefaultsOnly, Category=Projectile)
-	TSubclassOf<class AParkourSystemProjectile> ProjectileClass;
+	TSoftClassPtr<AParkourSystemProjectile> ProjectileClass;
 
-	/** Sound to play each time we fire */
+	/** Sound to play each time we fire, streamed in by PreloadAssets() */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay)
-	USoundBase* FireSound;
+	TSoftObjectPtr<USoundBase> FireSound;
 	
-	/** AnimMontage to play each time we fire */
+	/** Looping sound played instead of FireSound while shots come faster than LoopFireInterval, streamed in by PreloadAssets() */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay)
+	TSoftObjectPtr<USoundBase> FireLoopSound;
+
+	/** Sound played when the fire loop stops, streamed in by PreloadAssets() */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay)
+	TSoftObjectPtr<USoundBase> FireTailSound;
+
+	/** Shots closer together than this many seconds are merged into FireLoopSound */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay, meta=(ClampMin="0"))
+	float LoopFireInterval;
+
+	/** Audio components reused for fire sounds, the oldest is stolen when all are playing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay, meta=(ClampMin="1"))
+	int32 AudioPoolSize;
+	
+	/** AnimMontage to play each time we fire, streamed in by PreloadAssets() */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Gameplay)
-	UAnimMontage* FireAnimation;
+	TSoftObjectPtr<UAnimMontage> FireAnimation;
 
 	/** Gun muzzle's offset from the characters location */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay)
@@ -45,16 +65,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Weapon")
 	void AttachWeapon(AParkourSystemCharacter* TargetCharacter);
 
+	/** Attaches to where the character currently holds weapons, Mesh1P only while it is registered */
+	void AttachToCharacter();
+
 	/** Make the weapon Fire a Projectile */
 	UFUNCTION(BlueprintCallable, Category="Weapon")
 	void Fire();
 
+	/** Start streaming in fire assets, kept loaded while the weapon exists */
+	UFUNCTION(BlueprintCallable, Category="Weapon")
+	void PreloadAssets();
+
 protected:
 	/** Ends gameplay for this component. */
 	UFUNCTION()
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	/** Play FireSound, or Keep the Fire Loop Going for Rapid Shots */
+	void PlayFireAudio();
+
+	/** Stop the Fire Loop and Play Its Tail, Once Shots Stopped Coming */
+	void ReleaseFireLoop();
+
+	/** Get an Idle Pooled Audio Component, Creating or Stealing One If Needed */
+	UAudioComponent* AcquireAudioComponent();
+
 private:
 	/** The Character holding this weapon*/
 	AParkourSystemCharacter* Character;
+
+	/** Keeps streamed fire assets loaded */
+	TSharedPtr<FStreamableHandle> AssetsHandle;
+
+	/** Fire audio components owned by this weapon */
+	UPROPERTY(Transient)
+	TArray<UAudioComponent*> AudioPool;
+
+	/** Pooled component playing FireLoopSound, null while not looping */
+	UPROPERTY(Transient)
+	UAudioComponent* LoopAudioComponent;
+
+	/** Next component to steal when the whole pool is playing */
+	int32 NextStolenAudioIndex;
+
+	/** World time of the previous shot */
+	double LastFireTime;
+
+	/** Fires ReleaseFireLoop once shots stop */
+	FTimerHandle LoopReleaseTimer;
 };